@@ -6,6 +6,7 @@
 
 //#include <Arduino.h>  appears to be automatically added by framework specified in platformio.ini
 #include <Arduino.h>
+#include <esp_heap_caps.h>
 
 // #include "soc/soc.h"            // brownout detector
 // #include "soc/rtc_cntl_reg.h"   // brownout detector
@@ -29,6 +30,14 @@
 #include "env.h"
 #include "log.h"
 #include "esp32_util.h"
+#include "audio-player.h"
+#include "audio-arbiter.h"
+#include "tone-index.h"
+#include "tone-upload.h"
+#include "display-panel.h"
+#include "display-screens.h"
+#include "display-frame-cache.h"
+#include "graphic-store.h"
 
 // board has a single neopixel
 #define NUMPIXELS 1
@@ -49,325 +58,42 @@
 
 // Directory on SDcard where tones are stored. 
 #define TONE_DIR "/tones"
+// Binary index of the tones in TONE_DIR (name, codec, audio data offset, duration, checksum); rebuilt when tones change
+#define TONE_INDEX_FILE "/tones.idx"
+
+// Read-ahead buffer between the SD card and the VS1053 (internal RAM); rounded to a power of two of at least 8KB
+#define AUDIO_READAHEAD_SIZE (16 * 1024)
+
+// PSRAM jitter buffer for HTTP streams (about 16s of 128kbit/s mp3)
+#define AUDIO_STREAM_BUFFER_SIZE (256 * 1024)
+
+// Most PSRAM (2MB on the Feather ESP32-S2) given to caching tones; the cache gets what is left once the stream jitter
+// buffer, upload slots and display frame cache have theirs, less PSRAM_RESERVE
+#define TONE_CACHE_BUDGET (1536 * 1024)
+// PSRAM kept free of the tone cache for what is claimed after boot: uploaded graphics (GRAPHIC_STORE_BUDGET), the strip
+// of scrolling text (up to 55KB) and the core's own allocations
+#define PSRAM_RESERVE (GRAPHIC_STORE_BUDGET + 128 * 1024)
+// Load every tone into the cache at boot (as budget allows); otherwise tones are cached on first use
+#define TONE_CACHE_PRELOAD true
+
+// Equal priority siren commands arriving within this window of the one playing are merged into it (doorbell mashing)
+#define AUDIO_COALESCE_WINDOW_MS 5000
 
 // Display
 // Used for I2C or SPI
 #define OLED_RESET -1
 #define DISPLAY_WIDTH 128
 #define DISPLAY_HEIGHT 128
-
-// ***
-// These graphics below are internal to the device and are used exclusively to indicate device status such as wifi or MQTT broker 
-// disconnect or some internal component initialization problem. They are not among the list of graphics that can be set via MQTT.
-
-#define WIFI_ALERT_HEIGHT 96
-#define WIFI_ALERT_WIDTH 96
-
-// array size is 1152
-static const unsigned char WIFI_ALERT_BITMAP[] PROGMEM  = {
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B01111111, B11111110, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111100, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11100000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000001, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000000, B00000000, B00000000, 
-  B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11100000, B00000000, B00000000, 
-  B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, 
-  B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, B00000000, 
-  B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, B00000000, 
-  B00000000, B00011111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, B00000000, 
-  B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, B00000000, 
-  B00000000, B11111111, B11111111, B11111111, B11111111, B10000000, B00000001, B11111111, B11111111, B00000000, B00000000, B00000000, 
-  B00000011, B11111111, B11111111, B11111111, B11100000, B00000000, B00000000, B00000111, B11111111, B00000000, B00000000, B00000000, 
-  B00000111, B11111111, B11111111, B11111110, B00000000, B00000000, B00000000, B00000000, B01111111, B00000000, B00000000, B00000000, 
-  B00000011, B11111111, B11111111, B11110000, B00000000, B00000000, B00000000, B00000000, B00001111, B00000000, B00000000, B00000000, 
-  B00000011, B11111111, B11111111, B10000000, B00000000, B00000000, B00000000, B00000000, B00000001, B00000000, B11111111, B00000000, 
-  B00000001, B11111111, B11111110, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B11111111, B11111000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B01111111, B11100000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B01111111, B10000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00111111, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00011100, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00001000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11111100, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11110000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B01111111, B11111111, B11111111, B11111110, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11110000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000111, B11111111, B11111111, B11100000, B00000111, B11111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000011, B11111111, B11111100, B00000000, B00000000, B00111111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000001, B11111111, B11100000, B00000000, B00000000, B00000111, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B11111111, B10000000, B00000000, B00000000, B00000001, B11111111, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B11111110, B00000000, B00000000, B00000000, B00000000, B01111111, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B01111000, B00000000, B00000000, B00000000, B00000000, B00011110, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00100000, B00000000, B00000000, B00000000, B00000000, B00000100, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00011111, B11111000, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B11111111, B00000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000011, B11111111, B11111111, B11000000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11110000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111100, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111100, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00011111, B11111111, B11111111, B11111000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11110000, B00000000, B00000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11110000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000111, B11111111, B11111111, B11100000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000011, B11111111, B11111111, B11000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000001, B11111111, B11111111, B10000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000001, B11111111, B11111111, B10000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B11111111, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B01111111, B11111110, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11111100, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11111100, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00011111, B11111000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00001111, B11110000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000111, B11100000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000111, B11100000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000011, B11000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000001, B10000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000
-};
-
-#define MQTT_ALERT_HEIGHT 96
-#define MQTT_ALERT_WIDTH 96
-
-// array size is 1152
-static const unsigned char MQTT_ALERT_BITMAP[] PROGMEM  = {
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, B00000000, 
-  B00011111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111000, B00000000, B00000000, 
-  B00111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, 
-  B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, 
-  B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B11111111, B00000000, B00000000, 
-  B11111111, B00111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B11111111, B00000000, B00000000, 
-  B11111111, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11110000, B11111111, B00000000, B00000000, 
-  B11111111, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B11111111, B00000000, B00000000, 
-  B11111111, B00000001, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000000, B11111111, B00000000, B11111111, 
-  B11111111, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B11111111, B00000000, B11111111, 
-  B11111111, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B11111111, B00000000, B11111111, 
-  B11111111, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11110000, B00000000, B11111111, B00000000, B11111111, 
-  B11111111, B10000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11000000, B00000001, B11111111, B00000000, B11111111, 
-  B11111111, B11000000, B00000001, B11111111, B11111111, B11111111, B11111111, B10000000, B00000011, B11111111, B00000000, B11111111, 
-  B11111111, B11110000, B00000000, B01111111, B11111111, B11111111, B11111110, B00000000, B00001111, B11111111, B00000000, B11111111, 
-  B11111111, B11111100, B00000000, B00111111, B11111111, B11111111, B11111100, B00000000, B00111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111110, B00000000, B00001111, B11111111, B11111111, B11110000, B00000000, B01111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B10000000, B00000011, B11111111, B11111111, B11000000, B00000001, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11000000, B00000001, B11111111, B11111111, B10000000, B00000011, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11110000, B00000000, B01111111, B11111110, B00000000, B00001111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111100, B00000000, B00111111, B11111100, B00000000, B00111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111110, B00000000, B00001111, B11110000, B00000000, B01111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B10000000, B00000011, B11000000, B00000001, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11000000, B00000001, B10000000, B00000011, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11110000, B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, B01111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B10000000, B00000001, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11000000, B00000011, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11110000, B00001111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111100, B00111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111110, B01111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B11111111, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, 
-  B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, 
-  B00111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, 
-  B00011111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111000, B00000000, B00000000, 
-  B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000
-};
-
-#define BROKEN_HEIGHT 96
-#define BROKEN_WIDTH 96
-
-// array size is 1152
-static const unsigned char BROKEN_BITMAP[] PROGMEM  = {
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11111100, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000111, B11111111, B11111111, B11100000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111100, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11110000, B00000000, B00011000, B00000000, 
-  B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00111100, B00000000, 
-  B00000000, B00000000, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00111100, B00000000, 
-  B00000000, B00000000, B00000001, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000000, B01111110, B00000000, 
-  B00000000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B11111111, B00000000, 
-  B00000000, B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000000, B11111111, B00000000, 
-  B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000001, B11111111, B10000000, 
-  B00000000, B00000000, B00011111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000001, B11111111, B10000000, 
-  B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000011, B11111111, B11000000, 
-  B00000000, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000011, B11111111, B11000000, 
-  B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000111, B11111111, B11100000, 
-  B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000111, B11111111, B11100000, 
-  B00000000, B00000001, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000111, B11111111, B11100000, 
-  B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00001111, B11111111, B11110000, 
-  B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00001111, B11111111, B11110000, 
-  B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00001111, B11111111, B11110000, 
-  B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00001111, B11111111, B11110000, 
-  B00000000, B00001111, B11111111, B11111111, B10011111, B11111111, B11111111, B11111001, B11111100, B00001111, B11111111, B11110000, 
-  B00000000, B00001111, B11111111, B11111111, B00001111, B11111111, B11111111, B11110000, B11111100, B00000111, B11111111, B11100000, 
-  B00000000, B00011111, B11111111, B11111110, B00000111, B11111111, B11111111, B11100000, B01111110, B00000111, B11111111, B11100000, 
-  B00000000, B00011111, B11111111, B11111100, B00000011, B11111111, B11111111, B11000000, B00111110, B00000011, B11111111, B11000000, 
-  B00000000, B00111111, B11111111, B11111100, B00000001, B11111111, B11111111, B10000000, B00111111, B00000001, B11111111, B10000000, 
-  B00000000, B00111111, B11111111, B11111110, B00000000, B11111111, B11111111, B00000000, B01111111, B00000000, B01111110, B00000000, 
-  B00000000, B00111111, B11111111, B11111111, B00000000, B01111111, B11111110, B00000000, B11111111, B10000000, B00000000, B00000000, 
-  B00000000, B01111111, B11111111, B11111111, B10000000, B00111111, B11111100, B00000001, B11111111, B11000000, B00000000, B00000000, 
-  B00000000, B01111111, B11111111, B11111111, B10000000, B01111111, B11111110, B00000001, B11111111, B11100000, B00000000, B00000000, 
-  B00000000, B01111111, B11111111, B11111111, B00000000, B11111111, B11111111, B00000000, B11111111, B11110000, B00000000, B00000000, 
-  B00000000, B01111111, B11111111, B11111110, B00000001, B11111111, B11111111, B10000000, B01111111, B11111100, B00000000, B00000000, 
-  B00000000, B01111111, B11111111, B11111100, B00000011, B11111111, B11111111, B11000000, B00111111, B11111111, B00000000, B00000000, 
-  B00000000, B11111111, B00001111, B11111100, B00000111, B11111111, B11111111, B11100000, B00111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111100, B00000011, B11111110, B00001111, B11111111, B11111111, B11110000, B01111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111000, B00000001, B11111111, B00011111, B11111111, B11111111, B11111000, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111000, B00000001, B11111111, B10111111, B11111111, B11111111, B11111101, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11110000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11110000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11110000, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11110000, B00000000, B00011111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111100, B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B11111111, B00001000, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, 
-  B00000000, B01111111, B11111110, B00000000, B00011111, B11110000, B00001111, B11111111, B11111111, B11111111, B11111110, B00000000, 
-  B00000000, B01111111, B11111111, B10000000, B00000111, B00000000, B00000000, B11111111, B11111111, B11111111, B11111110, B00000000, 
-  B00000000, B01111111, B11111111, B11100000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111110, B00000000, 
-  B00000000, B01111111, B11111111, B11110000, B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11111110, B00000000, 
-  B00000000, B01111111, B11111111, B11111100, B00000000, B00000000, B00000000, B00000111, B11111111, B11111111, B11111110, B00000000, 
-  B00000000, B00111111, B11111111, B11111111, B00000000, B00000000, B00000000, B00000011, B11111111, B11111111, B11111100, B00000000, 
-  B00000000, B00111111, B11111111, B11111111, B00000000, B00001111, B11110000, B00000000, B11111111, B11111111, B11111100, B00000000, 
-  B00000000, B00111111, B11111111, B11111110, B00000000, B01111111, B11111110, B00000000, B11111111, B11111111, B11111100, B00000000, 
-  B00000000, B00011111, B11111111, B11111110, B00000000, B11111111, B11111111, B00000000, B01111111, B11111111, B11111000, B00000000, 
-  B00000000, B00011111, B11111111, B11111100, B00000011, B11111111, B11111111, B11000000, B00111111, B11111111, B11111000, B00000000, 
-  B00000000, B00001111, B11111111, B11111000, B00000111, B11111111, B11111111, B11100000, B00011111, B11111111, B11110000, B00000000, 
-  B00000000, B00001111, B11111111, B11111000, B00001111, B11111111, B11111111, B11110000, B00011111, B11111111, B11110000, B00000000, 
-  B00000000, B00000111, B11111111, B11110000, B00011111, B11111111, B11111111, B11111000, B00001111, B11111111, B11100000, B00000000, 
-  B00000000, B00000111, B11111111, B11110000, B00011111, B11111111, B11111111, B11111000, B00001111, B11111111, B11100000, B00000000, 
-  B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, 
-  B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, 
-  B00000000, B00000001, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000000, B00000000, 
-  B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, 
-  B00000000, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, 
-  B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, 
-  B00000000, B00000000, B00011111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111000, B00000000, B00000000, 
-  B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11110000, B00000000, B00000000, 
-  B00000000, B00000000, B00000111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11100000, B00000000, B00000000, 
-  B00000000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000001, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B10000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B01111111, B11111111, B11111111, B11111111, B11111111, B11111110, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111111, B11111111, B11111100, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00001111, B11111111, B11111111, B11111111, B11111111, B11110000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000011, B11111111, B11111111, B11111111, B11111111, B11000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B11111111, B11111111, B11111111, B11111111, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111, B11111100, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000111, B11111111, B11111111, B11100000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11111100, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, 
-  B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000
-};
+// Characters in a display command (Home Assistant's limit for a text entity); what does not fit on screen scrolls
+#define DISPLAY_TEXT_MAX 255
+// Graphics uploaded over MQTT (see graphic-store.h), on the SD card; looked up before the ones in graphics.h
+#define GRAPHIC_DIR "/graphics"
+// PSRAM for uploaded graphics in use (4.5KB each at 96x96, 16 grey levels)
+#define GRAPHIC_STORE_BUDGET (64 * 1024)
+// Recently drawn display commands kept as frames in PSRAM (8KB each), so going back to one is a copy; see display-frame-cache.h
+#define DISPLAY_FRAME_CACHE_FRAMES 8
+
+// Status screens (no wifi, no broker, broken) are in graphics.h with the selectable graphics.
 
 // *********************************************************************************************************************
 // *** Must Declare ***
@@ -0,0 +1,1033 @@
+#ifndef GLYPHS_H
+#define GLYPHS_H
+
+#include "display-panel.h"
+
+// *********************************************************************************************************************
+// Generated by lib/display/make-glyphs.py from Adafruit GFX's glcdfont.c; do not edit.
+// Characters 0x20 to 0x7e at text sizes 1, 2, 3, a row at a time as runs of (length - 1) << 4 | coverage;
+// see DisplayPanel::drawText().
+
+static const uint16_t GLYPH_OFFSETS_1[] PROGMEM = {
+  0, 8, 28, 48, 78, 102, 125, 155, 171, 193, 215, 242, 259, 275, 284, 296,
+  313, 342, 364, 384, 406, 430, 450, 472, 492, 518, 541, 553, 569, 591, 601, 623,
+  644, 671, 698, 721, 742, 767, 782, 797, 820, 847, 869, 892, 919, 934, 969, 1000,
+  1027, 1046, 1077, 1102, 1125, 1149, 1177, 1206, 1242, 1272, 1298, 1317, 1339, 1356, 1378, 1395,
+  1404, 1420, 1439, 1464, 1483, 1512, 1529, 1553, 1577, 1602, 1622, 1643, 1666, 1688, 1719, 1742,
+  1763, 1785, 1811, 1828, 1844, 1867, 1891, 1914, 1942, 1966, 1989, 2005, 2027, 2047, 2069
+};
+static const uint8_t GLYPH_RUNS_1[] PROGMEM = {
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x50, 0x10, 0x0f, 0x20, 0x50, 0x00, 0x0f, 0x00, 0x0f,
+  0x10, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x00, 0x0f, 0x00, 0x0f, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x4f, 0x00, 0x00, 0x0f, 0x00, 0x0f,
+  0x10, 0x4f, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x50, 0x10, 0x0f,
+  0x20, 0x00, 0x3f, 0x00, 0x0f, 0x00, 0x0f, 0x20, 0x00, 0x2f, 0x10, 0x10, 0x0f, 0x00, 0x0f, 0x00,
+  0x3f, 0x10, 0x10, 0x0f, 0x20, 0x50, 0x1f, 0x30, 0x1f, 0x10, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x10,
+  0x0f, 0x20, 0x00, 0x0f, 0x30, 0x0f, 0x10, 0x1f, 0x00, 0x20, 0x1f, 0x00, 0x50, 0x00, 0x0f, 0x30,
+  0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x30, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+  0x00, 0x0f, 0x10, 0x0f, 0x10, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x50, 0x10, 0x1f, 0x10, 0x10, 0x1f,
+  0x10, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x30, 0x50, 0x50, 0x50, 0x50, 0x20, 0x0f, 0x10, 0x10, 0x0f,
+  0x20, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10,
+  0x50, 0x00, 0x0f, 0x30, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10, 0x20, 0x0f, 0x10, 0x20, 0x0f, 0x10,
+  0x10, 0x0f, 0x20, 0x00, 0x0f, 0x30, 0x50, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x00, 0x2f, 0x10, 0x4f, 0x00, 0x00, 0x2f, 0x10, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x0f,
+  0x20, 0x50, 0x50, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x4f, 0x00, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x10, 0x1f, 0x10, 0x10, 0x1f, 0x10, 0x10, 0x0f, 0x20,
+  0x00, 0x0f, 0x30, 0x50, 0x50, 0x50, 0x4f, 0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x10, 0x1f, 0x10, 0x10, 0x1f, 0x10, 0x50, 0x50, 0x30, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x10,
+  0x0f, 0x20, 0x00, 0x0f, 0x30, 0x0f, 0x40, 0x50, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00,
+  0x0f, 0x10, 0x1f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x1f, 0x10, 0x0f, 0x00, 0x0f, 0x20,
+  0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x10, 0x0f, 0x20, 0x00, 0x1f, 0x20, 0x10, 0x0f, 0x20, 0x10,
+  0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x00, 0x2f, 0x10, 0x50, 0x00, 0x2f, 0x10, 0x0f,
+  0x20, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x2f, 0x10, 0x0f, 0x40, 0x0f, 0x40, 0x4f, 0x00, 0x50,
+  0x4f, 0x00, 0x30, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x10, 0x1f, 0x10, 0x30, 0x0f, 0x00, 0x0f, 0x20,
+  0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x20, 0x0f, 0x10, 0x10, 0x1f, 0x10, 0x00, 0x0f, 0x00, 0x0f,
+  0x10, 0x0f, 0x10, 0x0f, 0x10, 0x4f, 0x00, 0x20, 0x0f, 0x10, 0x20, 0x0f, 0x10, 0x50, 0x4f, 0x00,
+  0x0f, 0x40, 0x3f, 0x10, 0x30, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x2f,
+  0x10, 0x50, 0x10, 0x2f, 0x00, 0x00, 0x0f, 0x30, 0x0f, 0x40, 0x3f, 0x10, 0x0f, 0x20, 0x0f, 0x00,
+  0x0f, 0x20, 0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x4f, 0x00, 0x30, 0x0f, 0x00, 0x30, 0x0f, 0x00,
+  0x20, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x30, 0x0f, 0x40, 0x50, 0x00, 0x2f, 0x10, 0x0f,
+  0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20,
+  0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x00, 0x3f, 0x00, 0x30, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x2f, 0x20, 0x50, 0x50, 0x50, 0x10,
+  0x0f, 0x20, 0x50, 0x10, 0x0f, 0x20, 0x50, 0x50, 0x50, 0x50, 0x50, 0x10, 0x0f, 0x20, 0x50, 0x10,
+  0x0f, 0x20, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x30, 0x50, 0x30, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x10,
+  0x0f, 0x20, 0x00, 0x0f, 0x30, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10, 0x30, 0x0f, 0x00, 0x50, 0x50,
+  0x50, 0x4f, 0x00, 0x50, 0x4f, 0x00, 0x50, 0x50, 0x50, 0x00, 0x0f, 0x30, 0x10, 0x0f, 0x20, 0x20,
+  0x0f, 0x10, 0x30, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x30, 0x50, 0x00,
+  0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x10, 0x1f, 0x10, 0x10, 0x0f, 0x20, 0x50,
+  0x10, 0x0f, 0x20, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+  0x00, 0x0f, 0x00, 0x2f, 0x00, 0x0f, 0x00, 0x1f, 0x10, 0x0f, 0x40, 0x00, 0x3f, 0x00, 0x50, 0x10,
+  0x0f, 0x20, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x4f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x3f, 0x10, 0x0f, 0x20, 0x0f, 0x00,
+  0x0f, 0x20, 0x0f, 0x00, 0x3f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x3f, 0x10,
+  0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x20,
+  0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x3f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00,
+  0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x3f, 0x10, 0x50, 0x4f,
+  0x00, 0x0f, 0x40, 0x0f, 0x40, 0x3f, 0x10, 0x0f, 0x40, 0x0f, 0x40, 0x4f, 0x00, 0x50, 0x4f, 0x00,
+  0x0f, 0x40, 0x0f, 0x40, 0x3f, 0x10, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x40, 0x50, 0x00, 0x3f, 0x00,
+  0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x10, 0x1f, 0x00, 0x0f, 0x20, 0x0f, 0x00,
+  0x00, 0x3f, 0x00, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00,
+  0x4f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x00,
+  0x2f, 0x10, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x00, 0x2f, 0x10, 0x50, 0x10, 0x2f, 0x00, 0x20, 0x0f, 0x10, 0x20, 0x0f, 0x10, 0x20, 0x0f,
+  0x10, 0x20, 0x0f, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x00, 0x1f, 0x20, 0x50, 0x0f, 0x20, 0x0f, 0x00,
+  0x0f, 0x10, 0x0f, 0x10, 0x0f, 0x00, 0x0f, 0x20, 0x1f, 0x30, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x10,
+  0x0f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x40, 0x0f,
+  0x40, 0x0f, 0x40, 0x4f, 0x00, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x0f, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x1f, 0x10, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x1f, 0x00, 0x0f,
+  0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f,
+  0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00,
+  0x2f, 0x10, 0x50, 0x3f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x3f, 0x10, 0x0f,
+  0x40, 0x0f, 0x40, 0x0f, 0x40, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x0f, 0x10, 0x00,
+  0x1f, 0x00, 0x0f, 0x00, 0x50, 0x3f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x3f,
+  0x10, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x10, 0x0f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x00, 0x2f,
+  0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x40, 0x00, 0x2f, 0x10, 0x30, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x00, 0x2f, 0x10, 0x50, 0x4f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x0f, 0x20,
+  0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x50, 0x0f, 0x20, 0x0f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+  0x0f, 0x10, 0x10, 0x0f, 0x20, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20,
+  0x0f, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x0f,
+  0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00,
+  0x00, 0x0f, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x50, 0x4f, 0x00, 0x30, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x00, 0x2f, 0x10, 0x00, 0x0f, 0x30,
+  0x0f, 0x40, 0x4f, 0x00, 0x50, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x00, 0x0f,
+  0x30, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x00, 0x3f, 0x00, 0x50, 0x50, 0x0f, 0x40, 0x00, 0x0f,
+  0x30, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10, 0x30, 0x0f, 0x00, 0x50, 0x50, 0x00, 0x3f, 0x00, 0x30,
+  0x0f, 0x00, 0x30, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x3f,
+  0x00, 0x50, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x00, 0x50, 0x00, 0x1f, 0x20, 0x00,
+  0x1f, 0x20, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x1f,
+  0x20, 0x20, 0x0f, 0x10, 0x00, 0x2f, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x00, 0x3f, 0x00, 0x50, 0x0f,
+  0x40, 0x0f, 0x40, 0x0f, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x1f,
+  0x10, 0x0f, 0x00, 0x0f, 0x00, 0x1f, 0x10, 0x50, 0x50, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f,
+  0x00, 0x0f, 0x40, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x30, 0x0f, 0x00, 0x30, 0x0f,
+  0x00, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x1f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x10,
+  0x1f, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x50, 0x50, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f,
+  0x00, 0x4f, 0x00, 0x0f, 0x40, 0x00, 0x2f, 0x10, 0x50, 0x20, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x0f,
+  0x00, 0x10, 0x0f, 0x20, 0x00, 0x2f, 0x10, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20,
+  0x50, 0x50, 0x50, 0x00, 0x2f, 0x10, 0x0f, 0x10, 0x1f, 0x00, 0x0f, 0x10, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x2f, 0x10, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x00, 0x1f,
+  0x10, 0x1f, 0x10, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x50, 0x10, 0x0f, 0x20, 0x50, 0x00, 0x1f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10,
+  0x0f, 0x20, 0x00, 0x2f, 0x10, 0x50, 0x20, 0x0f, 0x10, 0x50, 0x20, 0x0f, 0x10, 0x20, 0x0f, 0x10,
+  0x20, 0x0f, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x00, 0x1f, 0x20, 0x50, 0x0f, 0x40, 0x0f, 0x40, 0x0f,
+  0x10, 0x0f, 0x10, 0x0f, 0x00, 0x0f, 0x20, 0x1f, 0x30, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x10, 0x0f,
+  0x10, 0x50, 0x00, 0x1f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x10, 0x0f, 0x20, 0x00, 0x2f, 0x10, 0x50, 0x50, 0x50, 0x1f, 0x00, 0x0f, 0x10, 0x0f, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x50, 0x50, 0x50, 0x0f, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x0f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x50, 0x50,
+  0x00, 0x2f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00,
+  0x2f, 0x10, 0x50, 0x50, 0x50, 0x0f, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x0f, 0x00, 0x1f, 0x10, 0x0f,
+  0x00, 0x0f, 0x00, 0x1f, 0x10, 0x0f, 0x40, 0x0f, 0x40, 0x50, 0x50, 0x00, 0x1f, 0x00, 0x0f, 0x00,
+  0x0f, 0x10, 0x1f, 0x00, 0x0f, 0x10, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x30, 0x0f, 0x00,
+  0x30, 0x0f, 0x00, 0x50, 0x50, 0x0f, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x0f, 0x00, 0x0f, 0x40, 0x0f,
+  0x40, 0x0f, 0x40, 0x50, 0x50, 0x50, 0x00, 0x3f, 0x00, 0x0f, 0x40, 0x00, 0x2f, 0x10, 0x30, 0x0f,
+  0x00, 0x3f, 0x10, 0x50, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x4f, 0x00, 0x10, 0x0f, 0x20, 0x10,
+  0x0f, 0x20, 0x10, 0x0f, 0x00, 0x0f, 0x00, 0x20, 0x0f, 0x10, 0x50, 0x50, 0x50, 0x0f, 0x20, 0x0f,
+  0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x10, 0x1f, 0x00, 0x00, 0x1f, 0x00,
+  0x0f, 0x00, 0x50, 0x50, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f,
+  0x00, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x50, 0x50, 0x50, 0x0f, 0x20, 0x0f, 0x00,
+  0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x00, 0x0f, 0x00, 0x0f, 0x10, 0x50, 0x50, 0x50, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x0f,
+  0x10, 0x10, 0x0f, 0x20, 0x00, 0x0f, 0x00, 0x0f, 0x10, 0x0f, 0x20, 0x0f, 0x00, 0x50, 0x50, 0x50,
+  0x0f, 0x20, 0x0f, 0x00, 0x0f, 0x20, 0x0f, 0x00, 0x00, 0x3f, 0x00, 0x30, 0x0f, 0x00, 0x0f, 0x20,
+  0x0f, 0x00, 0x00, 0x2f, 0x10, 0x50, 0x50, 0x4f, 0x00, 0x20, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x00,
+  0x0f, 0x30, 0x4f, 0x00, 0x50, 0x20, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x00, 0x0f,
+  0x30, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10, 0x50, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x10, 0x0f, 0x20, 0x50, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x50, 0x00,
+  0x0f, 0x30, 0x10, 0x0f, 0x20, 0x10, 0x0f, 0x20, 0x20, 0x0f, 0x10, 0x10, 0x0f, 0x20, 0x10, 0x0f,
+  0x20, 0x00, 0x0f, 0x30, 0x50, 0x00, 0x0f, 0x30, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x20, 0x0f,
+  0x10, 0x50, 0x50, 0x50, 0x50, 0x50
+};
+
+static const uint16_t GLYPH_OFFSETS_2[] PROGMEM = {
+  0, 16, 56, 96, 164, 224, 278, 350, 385, 437, 489, 551, 589, 624, 642, 666,
+  708, 778, 826, 875, 929, 986, 1034, 1090, 1139, 1207, 1265, 1289, 1323, 1379, 1399, 1455,
+  1504, 1565, 1629, 1687, 1737, 1793, 1827, 1860, 1913, 1971, 2019, 2071, 2135, 2166, 2238, 2304,
+  2366, 2411, 2483, 2544, 2602, 2650, 2710, 2774, 2848, 2920, 2978, 3024, 3070, 3112, 3158, 3198,
+  3216, 3251, 3299, 3357, 3403, 3469, 3512, 3566, 3623, 3677, 3720, 3766, 3818, 3865, 3928, 3978,
+  4028, 4078, 4136, 4174, 4214, 4266, 4318, 4370, 4428, 4488, 4542, 4582, 4634, 4674, 4726
+};
+static const uint8_t GLYPH_RUNS_2[] PROGMEM = {
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30,
+  0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10,
+  0x1f, 0x30, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10, 0x1f,
+  0x30, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x00,
+  0x06, 0x1f, 0x16, 0x1f, 0x06, 0x20, 0x9f, 0x10, 0x9f, 0x10, 0x00, 0x06, 0x1f, 0x16, 0x1f, 0x06,
+  0x20, 0x00, 0x06, 0x1f, 0x16, 0x1f, 0x06, 0x20, 0x9f, 0x10, 0x9f, 0x10, 0x00, 0x06, 0x1f, 0x16,
+  0x1f, 0x06, 0x20, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0x10, 0x1f, 0x10,
+  0x1f, 0x30, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x10, 0x7f, 0x10, 0x00,
+  0x06, 0x7f, 0x10, 0x1f, 0x16, 0x1f, 0x06, 0x40, 0x1f, 0x16, 0x1f, 0x06, 0x40, 0x00, 0x06, 0x5f,
+  0x30, 0x10, 0x5f, 0x06, 0x20, 0x20, 0x06, 0x1f, 0x16, 0x1f, 0x10, 0x20, 0x06, 0x1f, 0x16, 0x1f,
+  0x10, 0x7f, 0x06, 0x20, 0x7f, 0x30, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50, 0xb0, 0xb0,
+  0x3f, 0x70, 0x3f, 0x70, 0x3f, 0x30, 0x1f, 0x10, 0x3f, 0x20, 0x06, 0x1f, 0x10, 0x50, 0x1f, 0x06,
+  0x20, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06,
+  0x60, 0x00, 0x06, 0x1f, 0x70, 0x1f, 0x06, 0x20, 0x3f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x50, 0x3f,
+  0x10, 0x50, 0x3f, 0x10, 0xb0, 0xb0, 0x10, 0x1f, 0x70, 0x00, 0x06, 0x1f, 0x06, 0x60, 0x1f, 0x16,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x16, 0x1f, 0x50, 0x00, 0x06,
+  0x1f, 0x06, 0x60, 0x00, 0x06, 0x1f, 0x06, 0x60, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x20, 0x06, 0x1f, 0x06, 0x20, 0x1f, 0x06, 0x10, 0x06, 0x1f, 0x06,
+  0x20, 0x00, 0x06, 0x3f, 0x16, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0xb0, 0xb0, 0x30, 0x3f,
+  0x30, 0x30, 0x3f, 0x30, 0x30, 0x3f, 0x30, 0x30, 0x3f, 0x30, 0x30, 0x1f, 0x06, 0x40, 0x20, 0x06,
+  0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x50, 0x1f, 0x30, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x50,
+  0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70,
+  0x10, 0x1f, 0x06, 0x60, 0x20, 0x06, 0x1f, 0x50, 0x30, 0x1f, 0x06, 0x40, 0x40, 0x06, 0x1f, 0x30,
+  0x50, 0x1f, 0x30, 0xb0, 0xb0, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x06, 0x60, 0x20, 0x06, 0x1f, 0x50,
+  0x30, 0x1f, 0x06, 0x40, 0x40, 0x06, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f,
+  0x30, 0x50, 0x1f, 0x30, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x50,
+  0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x1f,
+  0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x16, 0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20,
+  0x00, 0x06, 0x5f, 0x06, 0x20, 0x9f, 0x10, 0x9f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x00, 0x06,
+  0x5f, 0x06, 0x20, 0x1f, 0x16, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x30,
+  0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30,
+  0x1f, 0x50, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x9f, 0x10, 0x9f, 0x10, 0x20, 0x06, 0x1f, 0x06, 0x40,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x30, 0x3f, 0x30, 0x30, 0x3f, 0x30, 0x30, 0x3f, 0x30, 0x30, 0x3f,
+  0x30, 0x30, 0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x30, 0x3f, 0x30, 0x30,
+  0x3f, 0x30, 0x30, 0x3f, 0x30, 0x30, 0x3f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0x70, 0x1f, 0x10, 0x60,
+  0x06, 0x1f, 0x10, 0x50, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06, 0x40, 0x20,
+  0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x00, 0x06, 0x1f, 0x70, 0x1f, 0x06, 0x80, 0x1f, 0x90,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06,
+  0x1f, 0x10, 0x1f, 0x40, 0x06, 0x1f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x20, 0x06, 0x3f, 0x10,
+  0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10, 0x3f, 0x06, 0x20, 0x1f,
+  0x10, 0x3f, 0x30, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f,
+  0x50, 0x10, 0x3f, 0x50, 0x10, 0x3f, 0x50, 0x20, 0x06, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f,
+  0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f,
+  0x06, 0x40, 0x10, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f,
+  0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x60,
+  0x06, 0x1f, 0x10, 0x10, 0x5f, 0x06, 0x20, 0x00, 0x06, 0x5f, 0x30, 0x1f, 0x06, 0x80, 0x1f, 0x90,
+  0x1f, 0x90, 0x1f, 0x06, 0x80, 0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x60,
+  0x06, 0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x50, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x30,
+  0x3f, 0x30, 0x30, 0x3f, 0x06, 0x20, 0x60, 0x06, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0,
+  0xb0, 0x50, 0x1f, 0x30, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x3f, 0x30, 0x20, 0x06, 0x3f, 0x30, 0x10,
+  0x1f, 0x16, 0x1f, 0x30, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x30, 0x1f, 0x06, 0x20, 0x1f, 0x30, 0x1f,
+  0x06, 0x10, 0x06, 0x1f, 0x06, 0x20, 0x9f, 0x10, 0x9f, 0x10, 0x40, 0x06, 0x1f, 0x06, 0x20, 0x50,
+  0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x06,
+  0x80, 0x1f, 0x06, 0x80, 0x7f, 0x30, 0x7f, 0x06, 0x20, 0x60, 0x06, 0x1f, 0x10, 0x70, 0x1f, 0x10,
+  0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x30, 0x5f, 0x10, 0x20, 0x06, 0x5f,
+  0x10, 0x10, 0x1f, 0x06, 0x60, 0x00, 0x06, 0x1f, 0x70, 0x1f, 0x06, 0x80, 0x1f, 0x06, 0x80, 0x7f,
+  0x30, 0x7f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30,
+  0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10,
+  0x60, 0x06, 0x1f, 0x10, 0x50, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06, 0x40,
+  0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x00, 0x06, 0x1f, 0x70, 0x1f, 0x06, 0x80, 0x1f,
+  0x90, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f,
+  0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00,
+  0x06, 0x5f, 0x06, 0x20, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f,
+  0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x5f,
+  0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f,
+  0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30,
+  0x06, 0x1f, 0x10, 0x00, 0x06, 0x7f, 0x10, 0x10, 0x7f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x60, 0x06,
+  0x1f, 0x10, 0x50, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x5f, 0x06, 0x40, 0x5f, 0x50, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06,
+  0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70, 0xb0, 0xb0, 0x70, 0x1f, 0x10, 0x60, 0x06,
+  0x1f, 0x10, 0x50, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06, 0x40, 0x20, 0x06,
+  0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x06, 0x60, 0x20, 0x06, 0x1f, 0x50, 0x30, 0x1f,
+  0x06, 0x40, 0x40, 0x06, 0x1f, 0x30, 0x50, 0x1f, 0x06, 0x20, 0x60, 0x06, 0x1f, 0x10, 0x70, 0x1f,
+  0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0, 0x9f, 0x10, 0x9f,
+  0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x06, 0x60, 0x20, 0x06,
+  0x1f, 0x50, 0x30, 0x1f, 0x06, 0x40, 0x40, 0x06, 0x1f, 0x30, 0x50, 0x1f, 0x06, 0x20, 0x60, 0x06,
+  0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x50, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f,
+  0x06, 0x40, 0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70, 0xb0, 0xb0, 0x10,
+  0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0x70, 0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x30, 0x3f, 0x06, 0x20, 0x30, 0x3f, 0x30, 0x30,
+  0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0,
+  0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10,
+  0x5f, 0x10, 0x1f, 0x10, 0x5f, 0x10, 0x1f, 0x10, 0x3f, 0x06, 0x20, 0x1f, 0x10, 0x3f, 0x30, 0x1f,
+  0x90, 0x1f, 0x06, 0x80, 0x00, 0x06, 0x7f, 0x10, 0x10, 0x7f, 0x10, 0xb0, 0xb0, 0x30, 0x1f, 0x50,
+  0x20, 0x06, 0x1f, 0x06, 0x40, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06,
+  0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f,
+  0x06, 0x30, 0x06, 0x1f, 0x10, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f,
+  0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0x7f, 0x30, 0x7f,
+  0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x7f, 0x06, 0x20, 0x7f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x7f, 0x06, 0x20, 0x7f, 0x30, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f,
+  0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f,
+  0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00,
+  0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x7f, 0x30, 0x7f, 0x06, 0x20, 0x1f, 0x06,
+  0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x7f, 0x06, 0x20, 0x7f, 0x30, 0xb0,
+  0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x06, 0x80, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x06, 0x80, 0x7f,
+  0x30, 0x7f, 0x30, 0x1f, 0x06, 0x80, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x06, 0x80, 0x9f, 0x10, 0x9f,
+  0x10, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x06, 0x80, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x06,
+  0x80, 0x7f, 0x30, 0x7f, 0x30, 0x1f, 0x06, 0x80, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90,
+  0x1f, 0x90, 0xb0, 0xb0, 0x10, 0x7f, 0x10, 0x00, 0x06, 0x7f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f,
+  0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x30, 0x3f,
+  0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x40, 0x06, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x00, 0x06, 0x7f, 0x10, 0x10, 0x7f, 0x10, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30,
+  0x06, 0x1f, 0x10, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x30, 0x1f,
+  0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x10, 0x5f, 0x30, 0x10, 0x5f,
+  0x30, 0xb0, 0xb0, 0x30, 0x5f, 0x10, 0x30, 0x5f, 0x10, 0x40, 0x06, 0x1f, 0x06, 0x20, 0x50, 0x1f,
+  0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30,
+  0x50, 0x1f, 0x30, 0x1f, 0x30, 0x1f, 0x30, 0x1f, 0x06, 0x10, 0x06, 0x1f, 0x30, 0x00, 0x06, 0x3f,
+  0x06, 0x40, 0x10, 0x3f, 0x50, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x40, 0x06, 0x1f, 0x10,
+  0x1f, 0x30, 0x1f, 0x06, 0x20, 0x1f, 0x20, 0x06, 0x1f, 0x30, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f,
+  0x16, 0x1f, 0x50, 0x3f, 0x06, 0x60, 0x3f, 0x06, 0x60, 0x1f, 0x16, 0x1f, 0x50, 0x1f, 0x10, 0x1f,
+  0x06, 0x40, 0x1f, 0x20, 0x06, 0x1f, 0x30, 0x1f, 0x30, 0x1f, 0x06, 0x20, 0x1f, 0x40, 0x06, 0x1f,
+  0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f,
+  0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x06, 0x80,
+  0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x3f, 0x10, 0x3f, 0x10, 0x3f, 0x16, 0x3f, 0x10, 0x1f, 0x16, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f, 0x10, 0x3f,
+  0x30, 0x1f, 0x10, 0x3f, 0x06, 0x20, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x20, 0x06, 0x3f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x40, 0x06,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0,
+  0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06,
+  0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x7f, 0x30,
+  0x7f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x7f, 0x06, 0x20, 0x7f, 0x30, 0x1f, 0x06, 0x80, 0x1f,
+  0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06,
+  0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f,
+  0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x10, 0x1f,
+  0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x20, 0x06, 0x1f, 0x06, 0x20, 0x1f,
+  0x06, 0x10, 0x06, 0x1f, 0x06, 0x20, 0x00, 0x06, 0x3f, 0x16, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f,
+  0x10, 0xb0, 0xb0, 0x7f, 0x30, 0x7f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x7f, 0x06, 0x20, 0x7f,
+  0x30, 0x1f, 0x16, 0x1f, 0x06, 0x40, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f, 0x20, 0x06, 0x1f, 0x30,
+  0x1f, 0x30, 0x1f, 0x06, 0x20, 0x1f, 0x40, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0,
+  0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x90, 0x1f, 0x06, 0x80, 0x00, 0x06, 0x5f, 0x30, 0x10, 0x5f, 0x06, 0x20, 0x60,
+  0x06, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x16,
+  0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30,
+  0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06,
+  0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06, 0x20, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x20, 0x06, 0x1f, 0x06,
+  0x40, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x16,
+  0x1f, 0x10, 0x00, 0x06, 0x1f, 0x16, 0x1f, 0x06, 0x20, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0xb0, 0xb0,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06,
+  0x1f, 0x10, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06, 0x20, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x20, 0x06,
+  0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x00, 0x06, 0x1f,
+  0x10, 0x1f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06,
+  0x20, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50, 0x30, 0x1f,
+  0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x50, 0x1f,
+  0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x10, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0x10, 0x1f, 0x06, 0x60,
+  0x00, 0x06, 0x1f, 0x70, 0x1f, 0x06, 0x80, 0x1f, 0x06, 0x80, 0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0,
+  0x10, 0x7f, 0x10, 0x10, 0x7f, 0x10, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70,
+  0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x70, 0x10,
+  0x1f, 0x70, 0x10, 0x1f, 0x06, 0x60, 0x10, 0x7f, 0x10, 0x10, 0x7f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x1f, 0x90, 0x1f, 0x06, 0x80, 0x00, 0x06, 0x1f, 0x70, 0x10, 0x1f, 0x06, 0x60, 0x20, 0x06, 0x1f,
+  0x50, 0x30, 0x1f, 0x06, 0x40, 0x40, 0x06, 0x1f, 0x30, 0x50, 0x1f, 0x06, 0x20, 0x60, 0x06, 0x1f,
+  0x10, 0x70, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0x10, 0x7f, 0x10, 0x10, 0x7f, 0x10, 0x60, 0x06,
+  0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f,
+  0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x10, 0x7f,
+  0x10, 0x10, 0x7f, 0x10, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x10, 0x1f,
+  0x16, 0x1f, 0x30, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0,
+  0x10, 0x3f, 0x50, 0x10, 0x3f, 0x50, 0x10, 0x3f, 0x50, 0x10, 0x3f, 0x50, 0x20, 0x06, 0x1f, 0x50,
+  0x30, 0x1f, 0x06, 0x40, 0x40, 0x06, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x10, 0x3f, 0x50, 0x10, 0x3f, 0x06, 0x40, 0x40, 0x06,
+  0x1f, 0x30, 0x40, 0x06, 0x1f, 0x30, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x30, 0x1f, 0x06, 0x10,
+  0x06, 0x1f, 0x30, 0x1f, 0x06, 0x10, 0x06, 0x1f, 0x06, 0x20, 0x00, 0x06, 0x7f, 0x10, 0x10, 0x7f,
+  0x10, 0xb0, 0xb0, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x10, 0x3f, 0x30, 0x1f,
+  0x16, 0x3f, 0x06, 0x20, 0x3f, 0x06, 0x10, 0x06, 0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x10, 0x1f, 0x06,
+  0x40, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x10, 0x3f, 0x06, 0x10, 0x06,
+  0x1f, 0x10, 0x1f, 0x16, 0x3f, 0x06, 0x20, 0x1f, 0x10, 0x3f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f,
+  0x50, 0x1f, 0x10, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f,
+  0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x70, 0x1f, 0x10, 0x70, 0x1f,
+  0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0x00, 0x06, 0x3f, 0x16,
+  0x1f, 0x10, 0x1f, 0x06, 0x10, 0x06, 0x3f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x40, 0x06, 0x1f,
+  0x10, 0x1f, 0x40, 0x06, 0x1f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x06, 0x10, 0x06, 0x3f, 0x10,
+  0x00, 0x06, 0x3f, 0x16, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f,
+  0x06, 0x30, 0x06, 0x1f, 0x10, 0x9f, 0x10, 0x9f, 0x10, 0x1f, 0x06, 0x80, 0x1f, 0x06, 0x80, 0x00,
+  0x06, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x50, 0x1f, 0x30, 0x40, 0x06, 0x1f, 0x06, 0x20,
+  0x30, 0x1f, 0x16, 0x1f, 0x10, 0x30, 0x1f, 0x10, 0x1f, 0x10, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f,
+  0x06, 0x40, 0x10, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x10, 0x5f, 0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x10, 0x06, 0x3f, 0x10,
+  0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x06, 0x10, 0x06, 0x3f, 0x10, 0x00, 0x06,
+  0x3f, 0x16, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10,
+  0x10, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f,
+  0x10, 0x3f, 0x30, 0x1f, 0x16, 0x3f, 0x06, 0x20, 0x3f, 0x06, 0x10, 0x06, 0x1f, 0x10, 0x3f, 0x30,
+  0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f,
+  0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x10, 0x3f, 0x50, 0x10, 0x3f, 0x50, 0x20, 0x06, 0x1f, 0x50, 0x30,
+  0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x06, 0x40,
+  0x10, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0xb0, 0xb0,
+  0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0x50,
+  0x1f, 0x30, 0x1f, 0x30, 0x1f, 0x30, 0x1f, 0x06, 0x10, 0x06, 0x1f, 0x30, 0x00, 0x06, 0x3f, 0x06,
+  0x40, 0x10, 0x3f, 0x50, 0xb0, 0xb0, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x30,
+  0x1f, 0x30, 0x1f, 0x20, 0x06, 0x1f, 0x30, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f, 0x16, 0x1f, 0x50,
+  0x3f, 0x06, 0x60, 0x3f, 0x06, 0x60, 0x1f, 0x16, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x40, 0x1f,
+  0x20, 0x06, 0x1f, 0x30, 0x1f, 0x30, 0x1f, 0x30, 0xb0, 0xb0, 0x10, 0x3f, 0x50, 0x10, 0x3f, 0x50,
+  0x20, 0x06, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x06,
+  0x40, 0x10, 0x5f, 0x30, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x3f, 0x10, 0x1f,
+  0x30, 0x3f, 0x16, 0x1f, 0x06, 0x20, 0x1f, 0x16, 0x1f, 0x16, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x1f, 0x10, 0x3f, 0x30,
+  0x1f, 0x16, 0x3f, 0x06, 0x20, 0x3f, 0x06, 0x10, 0x06, 0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x10, 0x1f,
+  0x06, 0x40, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x10, 0x5f,
+  0x30, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06,
+  0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x16, 0x3f, 0x06, 0x20, 0x3f, 0x06, 0x10, 0x06, 0x1f, 0x10, 0x3f,
+  0x30, 0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x10, 0x3f, 0x06, 0x10, 0x06, 0x1f, 0x10, 0x1f, 0x16, 0x3f,
+  0x06, 0x20, 0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0x00, 0x06, 0x3f, 0x16, 0x1f, 0x10, 0x1f, 0x06, 0x10,
+  0x06, 0x3f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x06, 0x10, 0x06, 0x3f,
+  0x10, 0x00, 0x06, 0x3f, 0x16, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70,
+  0x1f, 0x10, 0x70, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0x1f, 0x10, 0x3f, 0x30,
+  0x1f, 0x16, 0x3f, 0x06, 0x20, 0x3f, 0x06, 0x10, 0x06, 0x1f, 0x10, 0x3f, 0x30, 0x1f, 0x10, 0x1f,
+  0x06, 0x80, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0x1f, 0x90, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x10, 0x7f, 0x10, 0x00, 0x06, 0x7f, 0x10, 0x1f, 0x06, 0x80, 0x1f, 0x06, 0x80, 0x00,
+  0x06, 0x5f, 0x30, 0x10, 0x5f, 0x06, 0x20, 0x60, 0x06, 0x1f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x7f,
+  0x06, 0x20, 0x7f, 0x30, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20,
+  0x06, 0x1f, 0x06, 0x40, 0x9f, 0x10, 0x9f, 0x10, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x10, 0x1f, 0x10, 0x30, 0x1f, 0x16, 0x1f, 0x10,
+  0x40, 0x06, 0x1f, 0x06, 0x20, 0x50, 0x1f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x40, 0x06, 0x1f, 0x10, 0x1f, 0x30, 0x3f, 0x10, 0x1f, 0x06, 0x10, 0x06, 0x3f,
+  0x10, 0x00, 0x06, 0x3f, 0x16, 0x1f, 0x10, 0x10, 0x3f, 0x10, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x1f, 0x10,
+  0x1f, 0x06, 0x20, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x16, 0x1f, 0x10, 0x00, 0x06,
+  0x1f, 0x16, 0x1f, 0x06, 0x20, 0x10, 0x1f, 0x10, 0x1f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06,
+  0x20, 0x10, 0x1f, 0x16, 0x1f, 0x30, 0x20, 0x06, 0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x06, 0x40,
+  0x10, 0x1f, 0x16, 0x1f, 0x30, 0x00, 0x06, 0x1f, 0x10, 0x1f, 0x06, 0x20, 0x1f, 0x06, 0x30, 0x06,
+  0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10, 0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06,
+  0x7f, 0x10, 0x10, 0x7f, 0x10, 0x60, 0x06, 0x1f, 0x10, 0x70, 0x1f, 0x10, 0x1f, 0x50, 0x1f, 0x10,
+  0x1f, 0x06, 0x30, 0x06, 0x1f, 0x10, 0x00, 0x06, 0x5f, 0x06, 0x20, 0x10, 0x5f, 0x30, 0xb0, 0xb0,
+  0xb0, 0xb0, 0x9f, 0x10, 0x9f, 0x10, 0x40, 0x06, 0x1f, 0x06, 0x20, 0x40, 0x06, 0x1f, 0x30, 0x30,
+  0x1f, 0x06, 0x40, 0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x00, 0x06, 0x1f, 0x06, 0x60,
+  0x9f, 0x10, 0x9f, 0x10, 0xb0, 0xb0, 0x50, 0x1f, 0x30, 0x40, 0x06, 0x1f, 0x30, 0x30, 0x1f, 0x06,
+  0x40, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06, 0x60, 0x10,
+  0x1f, 0x06, 0x60, 0x20, 0x06, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x06,
+  0x40, 0x40, 0x06, 0x1f, 0x30, 0x50, 0x1f, 0x30, 0xb0, 0xb0, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0xb0, 0xb0, 0x30, 0x1f,
+  0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0xb0, 0xb0, 0x10, 0x1f, 0x70, 0x10, 0x1f, 0x06, 0x60, 0x20, 0x06, 0x1f, 0x50, 0x30, 0x1f, 0x50,
+  0x30, 0x1f, 0x50, 0x30, 0x1f, 0x06, 0x40, 0x40, 0x06, 0x1f, 0x30, 0x40, 0x06, 0x1f, 0x30, 0x30,
+  0x1f, 0x06, 0x40, 0x30, 0x1f, 0x50, 0x30, 0x1f, 0x50, 0x20, 0x06, 0x1f, 0x50, 0x10, 0x1f, 0x06,
+  0x60, 0x10, 0x1f, 0x70, 0xb0, 0xb0, 0x10, 0x1f, 0x70, 0x00, 0x06, 0x1f, 0x06, 0x60, 0x1f, 0x16,
+  0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x1f, 0x16, 0x1f, 0x10, 0x40, 0x06, 0x1f, 0x06, 0x20, 0x50,
+  0x1f, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0
+};
+
+static const uint16_t GLYPH_OFFSETS_3[] PROGMEM = {
+  0, 48, 114, 189, 318, 439, 535, 680, 749, 842, 935, 1055, 1127, 1196, 1244, 1298,
+  1382, 1514, 1595, 1685, 1783, 1888, 1974, 2078, 2168, 2295, 2402, 2456, 2522, 2626, 2674, 2778,
+  2868, 2977, 3095, 3202, 3292, 3388, 3448, 3505, 3597, 3693, 3774, 3864, 3985, 4036, 4162, 4278,
+  4386, 4467, 4599, 4713, 4821, 4904, 5003, 5115, 5244, 5379, 5482, 5564, 5639, 5723, 5798, 5886,
+  5934, 6003, 6096, 6205, 6295, 6416, 6500, 6597, 6706, 6800, 6875, 6956, 7053, 7131, 7248, 7342,
+  7438, 7536, 7646, 7722, 7801, 7895, 7992, 8092, 8203, 8326, 8425, 8504, 8596, 8662, 8754
+};
+static const uint8_t GLYPH_RUNS_3[] PROGMEM = {
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50,
+  0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f,
+  0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50,
+  0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x2f, 0x20,
+  0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f,
+  0x50, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x01, 0x40, 0x00, 0x01, 0x0d, 0x2f, 0x0d, 0x02,
+  0x0d, 0x2f, 0x0d, 0x02, 0x30, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x00, 0x02, 0x0d, 0x2f, 0x0c,
+  0x02, 0x0c, 0x2f, 0x0d, 0x02, 0x30, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x02, 0x40, 0x00,
+  0x02, 0x0d, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x0d, 0x02, 0x30, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20,
+  0x00, 0x01, 0x0d, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x2f, 0x02, 0x00,
+  0x02, 0x2f, 0x01, 0x40, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0x20, 0x2f,
+  0x20, 0x2f, 0x50, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f,
+  0x80, 0x40, 0x01, 0x2f, 0x02, 0x70, 0x30, 0x02, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20, 0xbf, 0x20,
+  0x10, 0x02, 0xbf, 0x20, 0x00, 0x01, 0x0d, 0xbf, 0x20, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x0c, 0x01,
+  0x60, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x02, 0x70, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x0c, 0x01, 0x60,
+  0x00, 0x02, 0x0d, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x0d, 0x02, 0x30, 0x30,
+  0x01, 0x0d, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x40, 0x04, 0x2f, 0x04, 0x00, 0x04, 0x2f, 0x20,
+  0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0xbf, 0x0c, 0x01, 0x30, 0xbf, 0x01, 0x40,
+  0xbf, 0x50, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x50, 0x2f,
+  0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x5f, 0xb0, 0x5f, 0xb0, 0x5f, 0xb0, 0x5f, 0x50, 0x2f,
+  0x20, 0x5f, 0x40, 0x02, 0x2f, 0x20, 0x5f, 0x30, 0x01, 0x0d, 0x2f, 0x20, 0x80, 0x2f, 0x0d, 0x02,
+  0x30, 0x70, 0x01, 0x2f, 0x01, 0x40, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x50, 0x2f, 0x0c, 0x01, 0x60,
+  0x40, 0x01, 0x2f, 0x01, 0x70, 0x30, 0x02, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x10,
+  0x02, 0x2f, 0x02, 0xa0, 0x00, 0x01, 0x0d, 0x2f, 0xb0, 0x2f, 0x0d, 0x01, 0x30, 0x5f, 0x20, 0x2f,
+  0x02, 0x40, 0x5f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x80, 0x5f, 0x20, 0x80, 0x5f, 0x20, 0x80, 0x5f,
+  0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x2f, 0xb0, 0x10, 0x01, 0x2f, 0x02, 0xa0, 0x00,
+  0x01, 0x0c, 0x2f, 0x0d, 0x01, 0x90, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x80, 0x2f, 0x01, 0x00, 0x01,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x80,
+  0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x80, 0x00, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x90, 0x10, 0x02, 0x2f,
+  0x02, 0xa0, 0x00, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x90, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x2f,
+  0x20, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x0d, 0x02,
+  0x0d, 0x2f, 0x20, 0x2f, 0x30, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x2f, 0x02, 0x30, 0x04, 0x2f,
+  0x02, 0x40, 0x2f, 0x0d, 0x01, 0x10, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x00, 0x01, 0x0d, 0x5f,
+  0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x10, 0x02, 0x5f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x20, 0x5f, 0x20,
+  0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f,
+  0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x2f, 0x0c, 0x01, 0x60, 0x40,
+  0x01, 0x2f, 0x01, 0x70, 0x30, 0x02, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0c, 0x01, 0x90, 0x20, 0x2f,
+  0x01, 0xa0, 0x20, 0x2f, 0xb0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x80, 0x2f, 0x50,
+  0x70, 0x02, 0x2f, 0x50, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x01,
+  0x2f, 0x02, 0x70, 0x30, 0x01, 0x0c, 0x2f, 0x80, 0x20, 0x2f, 0x0c, 0x01, 0x90, 0x20, 0x2f, 0x01,
+  0xa0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0,
+  0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x40, 0x02,
+  0x2f, 0x02, 0x70, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x70, 0x02, 0x2f,
+  0x50, 0x80, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0x02,
+  0xa0, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x30, 0x01, 0x0c, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x02, 0x70,
+  0x50, 0x2f, 0x0d, 0x01, 0x60, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x70, 0x01, 0x2f, 0x50, 0x80, 0x2f,
+  0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x70, 0x02, 0x2f,
+  0x50, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02, 0x2f, 0x02, 0x70,
+  0x30, 0x01, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f,
+  0xb0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x20,
+  0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02,
+  0x30, 0x10, 0x02, 0x8f, 0x02, 0x40, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02, 0x30, 0xef, 0x20, 0xef,
+  0x20, 0xef, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x04, 0x8f, 0x02, 0x40, 0x00,
+  0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20,
+  0x2f, 0x02, 0x00, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x30, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x60, 0xef, 0x20, 0xef,
+  0x20, 0xef, 0x20, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x50,
+  0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50,
+  0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f,
+  0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x80,
+  0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0xb0, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20,
+  0xef, 0x20, 0xef, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50,
+  0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x50, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xb0, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0x90,
+  0x01, 0x0d, 0x2f, 0x20, 0x80, 0x2f, 0x0d, 0x02, 0x30, 0x70, 0x01, 0x2f, 0x01, 0x40, 0x60, 0x01,
+  0x0c, 0x2f, 0x50, 0x50, 0x2f, 0x0c, 0x01, 0x60, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x30, 0x02, 0x0d,
+  0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x10, 0x02, 0x2f, 0x02, 0xa0, 0x00, 0x01, 0x0d, 0x2f,
+  0xb0, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0xe0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00, 0x01,
+  0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60,
+  0x04, 0x2f, 0x20, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x40, 0x01,
+  0x5f, 0x20, 0x2f, 0x30, 0x01, 0x0c, 0x5f, 0x20, 0x2f, 0x20, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x20,
+  0x2f, 0x01, 0x00, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x20,
+  0x2f, 0x20, 0x5f, 0x0d, 0x01, 0x30, 0x2f, 0x20, 0x5f, 0x02, 0x40, 0x2f, 0x20, 0x5f, 0x50, 0x2f,
+  0x20, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x20, 0x2f, 0x04, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01,
+  0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01,
+  0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x40, 0x01, 0x2f,
+  0x80, 0x30, 0x02, 0x0d, 0x2f, 0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x30,
+  0x02, 0x0d, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20, 0x8f, 0x50, 0x20,
+  0x8f, 0x50, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01,
+  0x8f, 0x01, 0x40, 0x00, 0x01, 0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d,
+  0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xa0,
+  0x01, 0x2f, 0x20, 0x90, 0x01, 0x0c, 0x2f, 0x20, 0x20, 0x8f, 0x0d, 0x02, 0x30, 0x10, 0x01, 0x8f,
+  0x01, 0x40, 0x00, 0x02, 0x0d, 0x8f, 0x50, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0xe0,
+  0x2f, 0xe0, 0x2f, 0x02, 0xd0, 0x2f, 0x0d, 0x01, 0xc0, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20,
+  0xa0, 0x04, 0x2f, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0x80, 0x2f, 0x0d, 0x02, 0x30, 0x70, 0x01,
+  0x2f, 0x01, 0x40, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x50, 0x5f, 0x50, 0x50, 0x5f, 0x01, 0x40, 0x50,
+  0x5f, 0x0d, 0x02, 0x30, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d,
+  0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f,
+  0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x80, 0x2f, 0x50, 0x70, 0x02, 0x2f, 0x50, 0x60, 0x01,
+  0x0d, 0x2f, 0x50, 0x50, 0x5f, 0x50, 0x40, 0x01, 0x5f, 0x50, 0x30, 0x01, 0x0c, 0x5f, 0x50, 0x20,
+  0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x50, 0x10, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x50, 0x00, 0x02,
+  0x0d, 0x2f, 0x20, 0x2f, 0x50, 0x2f, 0x0d, 0x02, 0x30, 0x2f, 0x50, 0x2f, 0x02, 0x30, 0x01, 0x2f,
+  0x01, 0x40, 0x2f, 0x0d, 0x02, 0x10, 0x01, 0x0c, 0x2f, 0x0d, 0x02, 0x30, 0xef, 0x20, 0xef, 0x20,
+  0xef, 0x20, 0x60, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x80, 0x2f,
+  0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x2f, 0x0c, 0x01, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0x0c, 0x01,
+  0xc0, 0xbf, 0x50, 0xbf, 0x01, 0x40, 0xbf, 0x0d, 0x02, 0x30, 0x90, 0x01, 0x0c, 0x2f, 0x20, 0xa0,
+  0x01, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f,
+  0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x8f, 0x20, 0x40, 0x01, 0x8f, 0x20, 0x30, 0x02, 0x0d,
+  0x8f, 0x20, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x10, 0x02, 0x2f, 0x02, 0xa0, 0x00, 0x01, 0x0d, 0x2f,
+  0xb0, 0x2f, 0x0d, 0x02, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0x0d, 0x02, 0xc0, 0xbf, 0x50, 0xbf, 0x01,
+  0x40, 0xbf, 0x0d, 0x02, 0x30, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60,
+  0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f,
+  0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30,
+  0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20,
+  0xef, 0x20, 0xef, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20,
+  0xb0, 0x2f, 0x20, 0xa0, 0x01, 0x2f, 0x20, 0x90, 0x01, 0x0c, 0x2f, 0x20, 0x80, 0x2f, 0x0d, 0x02,
+  0x30, 0x70, 0x01, 0x2f, 0x01, 0x40, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60,
+  0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x10,
+  0x02, 0x2f, 0x02, 0xa0, 0x00, 0x01, 0x0d, 0x2f, 0xb0, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x02, 0xd0,
+  0x2f, 0xe0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40,
+  0x00, 0x01, 0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f,
+  0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60,
+  0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0x8f, 0x0d,
+  0x02, 0x30, 0x10, 0x02, 0x8f, 0x02, 0x40, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0d,
+  0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d,
+  0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f,
+  0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00,
+  0x01, 0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01,
+  0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01,
+  0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0xbf, 0x20, 0x10,
+  0x01, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x04, 0x2f, 0x20, 0x90,
+  0x01, 0x0d, 0x2f, 0x20, 0x80, 0x2f, 0x0c, 0x01, 0x30, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x60, 0x01,
+  0x0d, 0x2f, 0x50, 0x8f, 0x0d, 0x01, 0x60, 0x8f, 0x02, 0x70, 0x8f, 0x80, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x40,
+  0x02, 0x2f, 0x80, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0x2f, 0x02,
+  0xa0, 0x20, 0x2f, 0xb0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xb0, 0x2f, 0x20, 0xa0, 0x02, 0x2f,
+  0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0x80, 0x2f, 0x0d, 0x02, 0x30, 0x70, 0x02, 0x2f, 0x01, 0x40,
+  0x60, 0x01, 0x0d, 0x2f, 0x50, 0x50, 0x2f, 0x0c, 0x01, 0x60, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x30,
+  0x02, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0c, 0x01, 0x90, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0x0c,
+  0x01, 0x90, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x50, 0x2f, 0x0d, 0x01,
+  0x60, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x80, 0x2f, 0x0c, 0x01, 0x30,
+  0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20,
+  0xef, 0x20, 0xef, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x30, 0x01,
+  0x0c, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x02, 0x70, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x60, 0x01, 0x0c,
+  0x2f, 0x50, 0x70, 0x01, 0x2f, 0x01, 0x40, 0x80, 0x2f, 0x0d, 0x02, 0x30, 0x90, 0x01, 0x0c, 0x2f,
+  0x20, 0xa0, 0x02, 0x2f, 0x20, 0x90, 0x01, 0x0c, 0x2f, 0x20, 0x80, 0x2f, 0x0c, 0x01, 0x30, 0x70,
+  0x02, 0x2f, 0x01, 0x40, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02,
+  0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0x2f, 0x02,
+  0xa0, 0x20, 0x2f, 0xb0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f,
+  0x01, 0x40, 0x00, 0x01, 0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f,
+  0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xa0, 0x01,
+  0x2f, 0x20, 0x90, 0x01, 0x0c, 0x2f, 0x20, 0x50, 0x5f, 0x0d, 0x02, 0x30, 0x50, 0x5f, 0x01, 0x40,
+  0x50, 0x5f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x50, 0x2f, 0x02, 0x70, 0x50, 0x2f, 0x80, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00, 0x01, 0x0c, 0x8f,
+  0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f,
+  0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x01, 0x00,
+  0x01, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x20, 0x2f, 0x20, 0x8f, 0x20, 0x2f,
+  0x20, 0x8f, 0x20, 0x2f, 0x20, 0x8f, 0x20, 0x2f, 0x20, 0x5f, 0x0c, 0x01, 0x30, 0x2f, 0x20, 0x5f,
+  0x01, 0x40, 0x2f, 0x20, 0x5f, 0x50, 0x2f, 0xe0, 0x2f, 0x02, 0xd0, 0x2f, 0x0d, 0x01, 0xc0, 0x00,
+  0x01, 0x0d, 0xbf, 0x20, 0x10, 0x02, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0x50, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x02, 0x70, 0x30, 0x02, 0x0d, 0x2f, 0x0d, 0x01, 0x60,
+  0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x50, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x01, 0x40,
+  0x00, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x30, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f,
+  0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0xef, 0x20, 0xef,
+  0x20, 0xef, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f,
+  0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f,
+  0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xbf, 0x50, 0xbf, 0x01, 0x40, 0xbf, 0x0d, 0x02, 0x30,
+  0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40,
+  0x01, 0x0c, 0x2f, 0x20, 0xbf, 0x0d, 0x02, 0x30, 0xbf, 0x02, 0x40, 0xbf, 0x0d, 0x02, 0x30, 0x2f,
+  0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f,
+  0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01,
+  0x0d, 0x2f, 0x20, 0xbf, 0x0c, 0x01, 0x30, 0xbf, 0x01, 0x40, 0xbf, 0x50, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00, 0x01, 0x0c, 0x8f, 0x0d, 0x02,
+  0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f,
+  0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f,
+  0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02,
+  0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xbf, 0x50, 0xbf, 0x01,
+  0x40, 0xbf, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60,
+  0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0xbf, 0x0c, 0x01,
+  0x30, 0xbf, 0x01, 0x40, 0xbf, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20,
+  0xef, 0x20, 0x2f, 0x0c, 0x01, 0xc0, 0x2f, 0x01, 0xd0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x01, 0xd0,
+  0x2f, 0x0d, 0x02, 0xc0, 0xbf, 0x50, 0xbf, 0x50, 0xbf, 0x50, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x02,
+  0xd0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x02, 0xd0, 0x2f, 0x0d, 0x01, 0xc0, 0xef, 0x20, 0xef, 0x20,
+  0xef, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x2f, 0x0c,
+  0x01, 0xc0, 0x2f, 0x01, 0xd0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x01, 0xd0, 0x2f, 0x0d, 0x02, 0xc0,
+  0xbf, 0x50, 0xbf, 0x50, 0xbf, 0x50, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0xe0, 0x2f,
+  0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0x20, 0xbf, 0x20, 0x10, 0x01, 0xbf, 0x20, 0x00, 0x01, 0x0c, 0xbf, 0x20, 0x2f, 0x0c, 0x01,
+  0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x50, 0x5f, 0x20, 0x2f,
+  0x50, 0x5f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60,
+  0x04, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0xbf, 0x20,
+  0x10, 0x02, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f,
+  0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f,
+  0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f,
+  0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x2f, 0x0d, 0x01,
+  0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50,
+  0x20, 0x8f, 0x50, 0x20, 0x8f, 0x50, 0x30, 0x01, 0x0c, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x01, 0x2f,
+  0x02, 0x70, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x50, 0x2f, 0x80, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20,
+  0x8f, 0x50, 0x20, 0x8f, 0x50, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x8f,
+  0x20, 0x50, 0x8f, 0x20, 0x50, 0x8f, 0x20, 0x60, 0x01, 0x0d, 0x2f, 0x0d, 0x02, 0x30, 0x70, 0x02,
+  0x2f, 0x01, 0x40, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80,
+  0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f,
+  0x50, 0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x02, 0x30, 0x02, 0x2f, 0x50, 0x2f, 0x0d, 0x01, 0x10, 0x01,
+  0x0d, 0x2f, 0x50, 0x00, 0x01, 0x0d, 0x5f, 0x0d, 0x01, 0x60, 0x10, 0x02, 0x5f, 0x02, 0x70, 0x20,
+  0x5f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x70, 0x02, 0x2f,
+  0x20, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x50, 0x2f, 0x0d, 0x02, 0x30, 0x2f, 0x40, 0x02,
+  0x2f, 0x01, 0x40, 0x2f, 0x30, 0x01, 0x0d, 0x2f, 0x50, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x60, 0x2f,
+  0x01, 0x00, 0x01, 0x2f, 0x01, 0x70, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x80, 0x5f, 0x0c, 0x01, 0x90,
+  0x5f, 0x02, 0xa0, 0x5f, 0x0c, 0x01, 0x90, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x80, 0x2f, 0x02, 0x00,
+  0x02, 0x2f, 0x02, 0x70, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x30, 0x01, 0x0d, 0x2f, 0x50,
+  0x2f, 0x40, 0x02, 0x2f, 0x01, 0x40, 0x2f, 0x50, 0x2f, 0x0c, 0x01, 0x30, 0x2f, 0x60, 0x01, 0x0d,
+  0x2f, 0x20, 0x2f, 0x70, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f,
+  0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f,
+  0xe0, 0x2f, 0x02, 0xd0, 0x2f, 0x0d, 0x01, 0xc0, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d,
+  0x02, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x5f, 0x20, 0x5f, 0x20, 0x5f, 0x02, 0x00, 0x02, 0x5f, 0x20,
+  0x5f, 0x0d, 0x02, 0x0d, 0x5f, 0x20, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x20,
+  0x2f, 0x01, 0x00, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x01, 0x70, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x60, 0x2f, 0x20, 0x5f, 0x50, 0x2f,
+  0x20, 0x5f, 0x01, 0x40, 0x2f, 0x20, 0x5f, 0x0c, 0x01, 0x30, 0x2f, 0x20, 0x2f, 0x0d, 0x04, 0x0d,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x20, 0x2f, 0x30, 0x01, 0x0d, 0x5f, 0x20, 0x2f, 0x40, 0x02, 0x5f,
+  0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x70, 0x02, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00, 0x01,
+  0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60,
+  0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d,
+  0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xbf, 0x50, 0xbf, 0x01, 0x40, 0xbf, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01,
+  0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f,
+  0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0xbf,
+  0x0d, 0x02, 0x30, 0xbf, 0x01, 0x40, 0xbf, 0x50, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x02, 0xd0, 0x2f,
+  0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00, 0x01, 0x0c, 0x8f, 0x0d,
+  0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x0d,
+  0x2f, 0x20, 0x2f, 0x30, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x2f, 0x02, 0x30, 0x04, 0x2f, 0x02,
+  0x40, 0x2f, 0x0d, 0x01, 0x10, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x00, 0x01, 0x0d, 0x5f, 0x0d,
+  0x02, 0x0d, 0x2f, 0x20, 0x10, 0x02, 0x5f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x20, 0x5f, 0x20, 0x2f,
+  0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xbf, 0x50, 0xbf, 0x01, 0x40, 0xbf, 0x0d, 0x02, 0x30,
+  0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40,
+  0x01, 0x0c, 0x2f, 0x20, 0xbf, 0x0d, 0x02, 0x30, 0xbf, 0x01, 0x40, 0xbf, 0x50, 0x2f, 0x0d, 0x02,
+  0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x04, 0x70, 0x2f, 0x20, 0x2f, 0x0d,
+  0x01, 0x60, 0x2f, 0x30, 0x01, 0x0d, 0x2f, 0x50, 0x2f, 0x40, 0x02, 0x2f, 0x01, 0x40, 0x2f, 0x50,
+  0x2f, 0x0c, 0x01, 0x30, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x70, 0x02, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01,
+  0x40, 0x00, 0x01, 0x0c, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20,
+  0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0xe0, 0x2f, 0x01, 0xd0, 0x2f,
+  0x0d, 0x02, 0xc0, 0x00, 0x02, 0x0d, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x0d,
+  0x02, 0x30, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20,
+  0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x2f, 0x0c, 0x02, 0x0c, 0x2f,
+  0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x2f,
+  0x20, 0x2f, 0x20, 0x2f, 0x20, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50,
+  0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d,
+  0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f,
+  0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d,
+  0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x01, 0x40, 0x20,
+  0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x50, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02, 0x2f,
+  0x02, 0x70, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f,
+  0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f,
+  0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x02, 0x00,
+  0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d,
+  0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x01,
+  0x40, 0x20, 0x2f, 0x20, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02,
+  0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0x2f, 0x20, 0x2f,
+  0x0d, 0x02, 0x30, 0x10, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x01, 0x40, 0x20, 0x2f, 0x0c, 0x02,
+  0x0c, 0x2f, 0x50, 0x30, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x60, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x30,
+  0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x60, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x50, 0x10, 0x02, 0x2f,
+  0x02, 0x00, 0x02, 0x2f, 0x01, 0x40, 0x00, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x30, 0x2f,
+  0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f,
+  0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x40, 0x01, 0x0d, 0x2f,
+  0x20, 0x00, 0x02, 0x0d, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x30, 0x10, 0x01, 0x2f, 0x01, 0x00, 0x01,
+  0x2f, 0x01, 0x40, 0x20, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x50, 0x30, 0x02, 0x0d, 0x2f, 0x0c, 0x01,
+  0x60, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50,
+  0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20,
+  0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x04, 0x2f, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0x80, 0x2f,
+  0x0d, 0x02, 0x30, 0x70, 0x01, 0x2f, 0x01, 0x40, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x20, 0x8f, 0x50,
+  0x20, 0x8f, 0x50, 0x20, 0x8f, 0x50, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x10, 0x02, 0x2f, 0x02, 0xa0,
+  0x00, 0x01, 0x0d, 0x2f, 0xb0, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x04, 0xd0, 0x2f, 0x0d, 0x01, 0xc0,
+  0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0xbf, 0x20, 0x20,
+  0xbf, 0x20, 0x20, 0xbf, 0x20, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f,
+  0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0,
+  0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0xb0, 0x20,
+  0x2f, 0x02, 0xa0, 0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0x20, 0xbf,
+  0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0xe0, 0x2f,
+  0x01, 0xd0, 0x2f, 0x0c, 0x01, 0xc0, 0x00, 0x02, 0x0d, 0x2f, 0xb0, 0x10, 0x01, 0x2f, 0x01, 0xa0,
+  0x20, 0x2f, 0x0c, 0x01, 0x90, 0x30, 0x02, 0x0d, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x50,
+  0x2f, 0x0c, 0x01, 0x60, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x80, 0x2f,
+  0x0c, 0x01, 0x30, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0xbf, 0x20, 0x20, 0xbf,
+  0x20, 0x20, 0xbf, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20,
+  0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0,
+  0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xa0, 0x02,
+  0x2f, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0x20, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0x20, 0xbf, 0x20,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x02, 0x70, 0x30, 0x02,
+  0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x50, 0x10, 0x02, 0x2f, 0x02,
+  0x00, 0x02, 0x2f, 0x01, 0x40, 0x00, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x30, 0x2f, 0x0d,
+  0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x5f,
+  0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80,
+  0x30, 0x02, 0x0d, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x50, 0x2f, 0x0c, 0x01, 0x60, 0x60,
+  0x01, 0x0c, 0x2f, 0x50, 0x70, 0x01, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20,
+  0x5f, 0x80, 0x20, 0x5f, 0x01, 0x70, 0x20, 0x5f, 0x0c, 0x01, 0x60, 0x60, 0x01, 0x0c, 0x2f, 0x50,
+  0x70, 0x02, 0x2f, 0x50, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x20, 0x8f, 0x50, 0x10, 0x02, 0x8f, 0x50,
+  0x00, 0x01, 0x0d, 0x8f, 0x50, 0x2f, 0x0d, 0x01, 0x10, 0x01, 0x0d, 0x2f, 0x50, 0x2f, 0x04, 0x30,
+  0x04, 0x2f, 0x01, 0x40, 0x2f, 0x0d, 0x01, 0x10, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x00, 0x01,
+  0x0d, 0xbf, 0x20, 0x10, 0x02, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x20, 0x5f, 0x50,
+  0x2f, 0x01, 0x00, 0x01, 0x5f, 0x01, 0x40, 0x2f, 0x0d, 0x04, 0x0d, 0x5f, 0x0d, 0x02, 0x30, 0x5f,
+  0x0c, 0x01, 0x10, 0x01, 0x0c, 0x2f, 0x20, 0x5f, 0x01, 0x30, 0x01, 0x2f, 0x20, 0x5f, 0x50, 0x2f,
+  0x20, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x20, 0x2f, 0x04, 0x70, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x60,
+  0x2f, 0x20, 0x5f, 0x50, 0x2f, 0x20, 0x5f, 0x02, 0x30, 0x02, 0x2f, 0x20, 0x5f, 0x0d, 0x01, 0x10,
+  0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x5f, 0x0c, 0x01, 0x30, 0x2f, 0x02, 0x00, 0x02,
+  0x5f, 0x01, 0x40, 0x2f, 0x20, 0x5f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01,
+  0x40, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20,
+  0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d,
+  0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f,
+  0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20,
+  0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0x20, 0x5f, 0x20, 0x2f, 0x20, 0x10, 0x01,
+  0x5f, 0x01, 0x00, 0x01, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0x5f, 0x0c, 0x02, 0x0c, 0x2f, 0x20, 0x2f,
+  0x0d, 0x02, 0x10, 0x01, 0x0c, 0x5f, 0x20, 0x2f, 0x01, 0x30, 0x01, 0x5f, 0x20, 0x2f, 0x50, 0x5f,
+  0x20, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x70, 0x04, 0x2f, 0x20, 0x2f, 0x60, 0x01, 0x0d,
+  0x2f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x02, 0x30, 0x02, 0x5f, 0x20, 0x2f, 0x0d, 0x01, 0x10,
+  0x01, 0x0d, 0x5f, 0x20, 0x00, 0x01, 0x0d, 0x5f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x10, 0x02, 0x5f,
+  0x02, 0x00, 0x02, 0x2f, 0x20, 0x20, 0x5f, 0x20, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10,
+  0x01, 0x8f, 0x01, 0x40, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0d, 0x02, 0x40, 0x01,
+  0x0c, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f,
+  0x20, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x2f, 0x0d, 0x01, 0xc0, 0x2f, 0x04, 0xd0, 0x2f, 0x0d,
+  0x01, 0xc0, 0x00, 0x01, 0x0d, 0x8f, 0x50, 0x10, 0x02, 0x8f, 0x50, 0x20, 0x8f, 0x50, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0x80, 0x2f, 0x50, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x60, 0x01, 0x0d, 0x2f,
+  0x0d, 0x02, 0x30, 0x50, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x50, 0x2f, 0x02, 0x00, 0x02, 0x2f,
+  0x20, 0x50, 0x2f, 0x20, 0x2f, 0x20, 0x50, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x01, 0x70, 0x30, 0x02,
+  0x0d, 0x2f, 0x0c, 0x01, 0x60, 0x20, 0x8f, 0x50, 0x20, 0x8f, 0x50, 0x20, 0x8f, 0x50, 0x30, 0x01,
+  0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f, 0x01, 0x40, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02, 0x30,
+  0x2f, 0x0d, 0x02, 0x10, 0x01, 0x0c, 0x5f, 0x20, 0x2f, 0x01, 0x30, 0x01, 0x5f, 0x20, 0x2f, 0x50,
+  0x5f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x02, 0x30, 0x02, 0x5f, 0x20, 0x2f, 0x0d, 0x01, 0x10,
+  0x01, 0x0d, 0x5f, 0x20, 0x00, 0x01, 0x0d, 0x5f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x10, 0x02, 0x5f,
+  0x02, 0x00, 0x02, 0x2f, 0x20, 0x20, 0x5f, 0x20, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xa0, 0x02, 0x2f,
+  0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0x20, 0x8f, 0x0c, 0x01, 0x30, 0x20, 0x8f, 0x01, 0x40, 0x20,
+  0x8f, 0x50, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x20,
+  0x5f, 0x50, 0x2f, 0x01, 0x00, 0x01, 0x5f, 0x01, 0x40, 0x2f, 0x0d, 0x04, 0x0d, 0x5f, 0x0d, 0x02,
+  0x30, 0x5f, 0x0c, 0x01, 0x10, 0x01, 0x0c, 0x2f, 0x20, 0x5f, 0x01, 0x30, 0x01, 0x2f, 0x20, 0x5f,
+  0x50, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x20, 0x2f, 0x02, 0x70, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20,
+  0x5f, 0x80, 0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x30, 0x02, 0x0d, 0x2f, 0x80, 0x40, 0x01, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20, 0x8f, 0x50, 0x20,
+  0x8f, 0x50, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x80, 0x2f, 0x50, 0x80, 0x2f,
+  0x50, 0x80, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50,
+  0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0x80,
+  0x2f, 0x50, 0x80, 0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x02, 0x30, 0x02, 0x2f, 0x50, 0x2f,
+  0x0d, 0x01, 0x10, 0x01, 0x0d, 0x2f, 0x50, 0x00, 0x01, 0x0d, 0x5f, 0x0d, 0x01, 0x60, 0x10, 0x02,
+  0x5f, 0x02, 0x70, 0x20, 0x5f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0xe0, 0x2f, 0xe0,
+  0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x40, 0x01, 0x2f,
+  0x50, 0x2f, 0x30, 0x01, 0x0c, 0x2f, 0x50, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x60, 0x2f, 0x01, 0x00,
+  0x01, 0x2f, 0x01, 0x70, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x80, 0x5f, 0x0d, 0x01, 0x90, 0x5f, 0x04,
+  0xa0, 0x5f, 0x0d, 0x01, 0x90, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x80, 0x2f, 0x02, 0x00, 0x02, 0x2f,
+  0x02, 0x70, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x30, 0x01, 0x0d, 0x2f, 0x50, 0x2f, 0x40,
+  0x02, 0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x5f, 0x80,
+  0x20, 0x5f, 0x80, 0x20, 0x5f, 0x80, 0x30, 0x01, 0x0c, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x80, 0x50,
+  0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20, 0x8f, 0x50, 0x20,
+  0x8f, 0x50, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x5f, 0x20, 0x2f, 0x50, 0x5f, 0x01, 0x00, 0x01, 0x2f,
+  0x01, 0x40, 0x5f, 0x0c, 0x02, 0x0c, 0x2f, 0x0d, 0x02, 0x30, 0x2f, 0x0d, 0x04, 0x0d, 0x2f, 0x0c,
+  0x02, 0x0c, 0x2f, 0x20, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x20, 0x5f, 0x50,
+  0x2f, 0x01, 0x00, 0x01, 0x5f, 0x01, 0x40, 0x2f, 0x0d, 0x04, 0x0d, 0x5f, 0x0d, 0x02, 0x30, 0x5f,
+  0x0c, 0x01, 0x10, 0x01, 0x0c, 0x2f, 0x20, 0x5f, 0x01, 0x30, 0x01, 0x2f, 0x20, 0x5f, 0x50, 0x2f,
+  0x20, 0x2f, 0x0d, 0x01, 0x60, 0x2f, 0x20, 0x2f, 0x02, 0x70, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x8f, 0x50, 0x10, 0x01, 0x8f,
+  0x01, 0x40, 0x00, 0x02, 0x0d, 0x8f, 0x0d, 0x02, 0x30, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f,
+  0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f,
+  0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01, 0x30,
+  0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x20, 0x5f, 0x50, 0x2f, 0x01,
+  0x00, 0x01, 0x5f, 0x01, 0x40, 0x2f, 0x0d, 0x04, 0x0d, 0x5f, 0x0d, 0x02, 0x30, 0x5f, 0x0c, 0x01,
+  0x10, 0x01, 0x0c, 0x2f, 0x20, 0x5f, 0x01, 0x30, 0x01, 0x2f, 0x20, 0x5f, 0x50, 0x2f, 0x20, 0x5f,
+  0x50, 0x2f, 0x20, 0x5f, 0x02, 0x30, 0x02, 0x2f, 0x20, 0x5f, 0x0d, 0x01, 0x10, 0x01, 0x0d, 0x2f,
+  0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x5f, 0x0c, 0x01, 0x30, 0x2f, 0x02, 0x00, 0x02, 0x5f, 0x01, 0x40,
+  0x2f, 0x20, 0x5f, 0x50, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x5f, 0x20, 0x2f,
+  0x20, 0x10, 0x01, 0x5f, 0x01, 0x00, 0x01, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0x5f, 0x0c, 0x02, 0x0c,
+  0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x10, 0x01, 0x0c, 0x5f, 0x20, 0x2f, 0x01, 0x30, 0x01, 0x5f, 0x20,
+  0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x02, 0x30, 0x02, 0x5f, 0x20, 0x2f, 0x0d,
+  0x01, 0x10, 0x01, 0x0d, 0x5f, 0x20, 0x00, 0x01, 0x0d, 0x5f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x10,
+  0x02, 0x5f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x20, 0x5f, 0x20, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0,
+  0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x20, 0x5f, 0x50, 0x2f, 0x01,
+  0x00, 0x01, 0x5f, 0x01, 0x40, 0x2f, 0x0d, 0x04, 0x0d, 0x5f, 0x0d, 0x02, 0x30, 0x5f, 0x0c, 0x01,
+  0x10, 0x01, 0x0c, 0x2f, 0x20, 0x5f, 0x01, 0x30, 0x01, 0x2f, 0x20, 0x5f, 0x50, 0x2f, 0x20, 0x2f,
+  0x0d, 0x01, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0, 0x2f, 0xe0,
+  0x2f, 0xe0, 0x2f, 0xe0, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0xbf, 0x20, 0x10, 0x01, 0xbf, 0x20, 0x00, 0x02, 0x0d,
+  0xbf, 0x20, 0x2f, 0x0d, 0x02, 0xc0, 0x2f, 0x02, 0xd0, 0x2f, 0x0d, 0x02, 0xc0, 0x00, 0x01, 0x0d,
+  0x8f, 0x50, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x0c, 0x01, 0x30, 0x90, 0x01, 0x0d, 0x2f,
+  0x20, 0xa0, 0x04, 0x2f, 0x20, 0x90, 0x01, 0x0d, 0x2f, 0x20, 0xbf, 0x0c, 0x01, 0x30, 0xbf, 0x01,
+  0x40, 0xbf, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50,
+  0x2f, 0x80, 0x50, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0c, 0x2f, 0x0d, 0x01,
+  0x60, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x30, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x60, 0x40, 0x01,
+  0x2f, 0x01, 0x70, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50,
+  0x2f, 0x20, 0x2f, 0x20, 0x50, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x50, 0x2f, 0x0d, 0x02, 0x0d,
+  0x2f, 0x20, 0x60, 0x01, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x80, 0x2f,
+  0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f,
+  0x70, 0x02, 0x2f, 0x20, 0x2f, 0x60, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x50, 0x5f, 0x20, 0x2f, 0x02,
+  0x30, 0x02, 0x5f, 0x20, 0x2f, 0x0d, 0x01, 0x10, 0x01, 0x0d, 0x5f, 0x20, 0x00, 0x01, 0x0d, 0x5f,
+  0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x10, 0x02, 0x5f, 0x02, 0x00, 0x02, 0x2f, 0x20, 0x20, 0x5f, 0x20,
+  0x2f, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01,
+  0x0d, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x01, 0x40,
+  0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x50, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x02,
+  0x2f, 0x02, 0x70, 0x50, 0x2f, 0x80, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20,
+  0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x02, 0x00, 0x02,
+  0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x2f,
+  0x0d, 0x02, 0x0d, 0x2f, 0x0c, 0x01, 0x30, 0x10, 0x02, 0x2f, 0x02, 0x00, 0x02, 0x2f, 0x01, 0x40,
+  0x20, 0x2f, 0x20, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f,
+  0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20, 0x00, 0x02, 0x0d, 0x2f, 0x20, 0x2f, 0x0d,
+  0x02, 0x30, 0x10, 0x01, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x01, 0x40, 0x20, 0x2f, 0x0c, 0x02, 0x0c,
+  0x2f, 0x50, 0x30, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x40, 0x04, 0x2f, 0x04, 0x70, 0x30, 0x01,
+  0x0d, 0x2f, 0x0d, 0x01, 0x60, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x50, 0x10, 0x02, 0x2f, 0x02,
+  0x00, 0x02, 0x2f, 0x01, 0x40, 0x00, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x0c, 0x01, 0x30, 0x2f, 0x0d,
+  0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x80,
+  0x2f, 0x20, 0x2f, 0x01, 0x60, 0x01, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x40, 0x01, 0x0c, 0x2f, 0x20,
+  0x00, 0x01, 0x0d, 0xbf, 0x20, 0x10, 0x02, 0xbf, 0x20, 0x20, 0xbf, 0x20, 0x90, 0x01, 0x0d, 0x2f,
+  0x20, 0xa0, 0x02, 0x2f, 0x20, 0xb0, 0x2f, 0x20, 0x2f, 0x80, 0x2f, 0x20, 0x2f, 0x02, 0x60, 0x02,
+  0x2f, 0x20, 0x2f, 0x0d, 0x01, 0x40, 0x01, 0x0d, 0x2f, 0x20, 0x00, 0x01, 0x0d, 0x8f, 0x0c, 0x01,
+  0x30, 0x10, 0x02, 0x8f, 0x01, 0x40, 0x20, 0x8f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0xef, 0x20, 0xef, 0x20, 0xef, 0x20, 0x60, 0x01, 0x0c, 0x2f, 0x0d,
+  0x02, 0x30, 0x70, 0x02, 0x2f, 0x01, 0x40, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01,
+  0x60, 0x40, 0x02, 0x2f, 0x02, 0x70, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0d, 0x01, 0x90,
+  0x10, 0x02, 0x2f, 0x04, 0xa0, 0x00, 0x01, 0x0d, 0x2f, 0x0d, 0x01, 0x90, 0xef, 0x20, 0xef, 0x20,
+  0xef, 0x20, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x80, 0x2f, 0x50, 0x70, 0x02, 0x2f, 0x50, 0x60,
+  0x01, 0x0d, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x50, 0x2f, 0x02, 0x70, 0x50, 0x2f, 0x80,
+  0x50, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x80, 0x30, 0x02, 0x0d, 0x2f, 0x80, 0x20, 0x2f, 0x0c, 0x01,
+  0x90, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0x0c, 0x01, 0x90, 0x30, 0x01, 0x0d, 0x2f, 0x80, 0x40,
+  0x02, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x02, 0x70, 0x50, 0x2f, 0x0d,
+  0x01, 0x60, 0x60, 0x01, 0x0d, 0x2f, 0x50, 0x70, 0x02, 0x2f, 0x50, 0x80, 0x2f, 0x50, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0xf0,
+  0x10, 0xf0, 0x10, 0xf0, 0x10, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x20, 0x2f, 0xb0, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0x0d,
+  0x01, 0x90, 0x30, 0x01, 0x0c, 0x2f, 0x80, 0x40, 0x01, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x50, 0x2f,
+  0x80, 0x50, 0x2f, 0x01, 0x70, 0x50, 0x2f, 0x0c, 0x01, 0x60, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x70,
+  0x02, 0x2f, 0x50, 0x60, 0x01, 0x0c, 0x2f, 0x50, 0x50, 0x2f, 0x0d, 0x01, 0x60, 0x50, 0x2f, 0x02,
+  0x70, 0x50, 0x2f, 0x80, 0x50, 0x2f, 0x80, 0x40, 0x02, 0x2f, 0x80, 0x30, 0x01, 0x0d, 0x2f, 0x80,
+  0x20, 0x2f, 0x0d, 0x01, 0x90, 0x20, 0x2f, 0x02, 0xa0, 0x20, 0x2f, 0xb0, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0x20, 0x2f, 0xb0, 0x10, 0x01, 0x2f, 0x02, 0xa0, 0x00, 0x01, 0x0c, 0x2f, 0x0d, 0x01,
+  0x90, 0x2f, 0x0c, 0x02, 0x0c, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x01, 0x00, 0x01, 0x2f, 0x02, 0x00,
+  0x02, 0x2f, 0x20, 0x2f, 0x20, 0x2f, 0x0d, 0x02, 0x0d, 0x2f, 0x20, 0x60, 0x01, 0x0c, 0x2f, 0x0d,
+  0x02, 0x30, 0x70, 0x01, 0x2f, 0x01, 0x40, 0x80, 0x2f, 0x50, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10,
+  0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0xf0, 0x10
+};
+
+static const display_glyphs GLYPH_ATLAS[] = {
+  { 1, 0x20, 95, GLYPH_OFFSETS_1, GLYPH_RUNS_1 },
+  { 2, 0x20, 95, GLYPH_OFFSETS_2, GLYPH_RUNS_2 },
+  { 3, 0x20, 95, GLYPH_OFFSETS_3, GLYPH_RUNS_3 }
+};
+#define GLYPH_ATLAS_COUNT 3
+
+#endif
@@ -0,0 +1,34 @@
+#include "audio-arbiter.h"
+
+static audio_arbiter_stats stats;
+static uint8_t playing_priority = 0;
+static unsigned long accepted_at = 0;   // millis() when the playing request was accepted
+
+arbiter_decision arbitrateAudio(uint8_t priority, uint32_t coalesce_window_ms){
+  arbiter_decision decision = ARBITER_PLAY;
+
+  if(audioIsPlaying()){
+    if(priority > playing_priority){
+      decision = ARBITER_PREEMPT;
+      stats.preempted++;
+    }
+    else if(priority < playing_priority){
+      decision = ARBITER_DROP;
+      stats.dropped++;
+    }
+    else if(millis() - accepted_at < coalesce_window_ms){
+      decision = ARBITER_COALESCE;
+      stats.coalesced++;
+    }
+  }
+
+  if(decision == ARBITER_PLAY || decision == ARBITER_PREEMPT){
+    playing_priority = priority;
+    accepted_at = millis();
+  }
+  return decision;
+}
+
+const audio_arbiter_stats &audioArbiterStats(){
+  return stats;
+}
@@ -0,0 +1,32 @@
+#ifndef AUDIO_ARBITER_H
+#define AUDIO_ARBITER_H
+
+#include <Arduino.h>
+#include "audio-player.h"
+
+/*
+  Decides whether a new siren request may interrupt what is already playing.
+
+  A request with a higher priority than the one playing preempts it. A request with a lower priority never interrupts
+  (a doorbell must not cut off a fire alarm). A request with the same priority arriving within the coalescing window of the
+  accepted one is merged into it instead of restarting the decoder, so a visitor mashing the doorbell hears a single chime.
+  Outside the window an equal priority request restarts playback.
+*/
+
+#define AUDIO_PRIORITY_DEFAULT 1
+
+// *********************************************************************************************************************
+// *** Data Types ***
+enum arbiter_decision { ARBITER_PLAY, ARBITER_PREEMPT, ARBITER_COALESCE, ARBITER_DROP };
+
+struct audio_arbiter_stats{
+  uint32_t preempted = 0;         // playing request interrupted by a higher priority one
+  uint32_t coalesced = 0;         // equal priority request merged into the playing one
+  uint32_t dropped = 0;           // lower priority request ignored
+};
+
+// Provided in library
+arbiter_decision arbitrateAudio(uint8_t priority, uint32_t coalesce_window_ms);   // call before starting playback; only play if ARBITER_PLAY or ARBITER_PREEMPT
+const audio_arbiter_stats &audioArbiterStats();
+
+#endif
@@ -0,0 +1,73 @@
+#include "audio-midi.h"
+
+/*
+  VLSI VS1053b real-time MIDI start plugin (rtmidi1053b), in the compressed plugin format Adafruit_VS1053::applyPatch() expects.
+*/
+static const uint16_t rtmidi_plugin[28] = {
+  0x0007, 0x0001, 0x8050, 0x0006, 0x0014, 0x0030, 0x0715, 0xb080,
+  0x3400, 0x0007, 0x9255, 0x3d00, 0x0024, 0x0030, 0x0295, 0x6890,
+  0x3400, 0x0030, 0x0495, 0x3d00, 0x0024, 0x2908, 0x4d40, 0x0030,
+  0x0200, 0x000a, 0x0001, 0x0050,
+};
+
+static int current_program = -1;
+
+// DREQ high, a tick at a time so that lower priority tasks run meanwhile; false if it timed out
+static bool waitForCodec(uint32_t timeout_ms){
+  unsigned long started = millis();
+  while(!musicPlayer.readyForData()){
+    if(millis() - started >= timeout_ms){
+      return false;
+    }
+    vTaskDelay(1);
+  }
+  return true;
+}
+
+// In real-time MIDI mode every byte on the data port is preceded by a zero byte
+static void sendMidi(uint8_t status, uint8_t data1, int data2){
+  uint8_t buf[6] = { 0, status, 0, data1, 0, (uint8_t)data2 };
+  uint8_t len = data2 < 0 ? 4 : 6;
+  waitForCodec(AUDIO_MIDI_READY_TIMEOUT_MS);
+  spiBusAcquire(SPI_DEVICE_CODEC_DATA);
+  musicPlayer.playData(buf, len);
+  spiBusRelease(SPI_DEVICE_CODEC_DATA);
+}
+
+void midiBegin(){
+  spiBusAcquire(SPI_DEVICE_CODEC_CMD);
+  musicPlayer.applyPatch(rtmidi_plugin, sizeof(rtmidi_plugin) / sizeof(rtmidi_plugin[0]));
+  spiBusRelease(SPI_DEVICE_CODEC_CMD);
+  current_program = -1;
+  Sprintln(F("MIDI mode"));
+}
+
+void midiNoteOn(uint8_t program, uint8_t note, uint8_t velocity){
+  if(program != current_program){
+    sendMidi(0xC0 | AUDIO_MIDI_CHANNEL, program & 0x7f, -1);  // program change
+    current_program = program;
+  }
+  sendMidi(0x90 | AUDIO_MIDI_CHANNEL, note & 0x7f, velocity & 0x7f);
+}
+
+void midiNoteOff(uint8_t note){
+  sendMidi(0x80 | AUDIO_MIDI_CHANNEL, note & 0x7f, 0);
+}
+
+void midiEnd(){
+  sendMidi(0xB0 | AUDIO_MIDI_CHANNEL, 123, 0);  // all notes off
+  // as Adafruit's softReset(), without its 100ms delay() while holding the bus
+  spiBusAcquire(SPI_DEVICE_CODEC_CMD);
+  musicPlayer.sciWrite(VS1053_REG_MODE, VS1053_MODE_SM_SDINEW | VS1053_MODE_SM_RESET);
+  spiBusRelease(SPI_DEVICE_CODEC_CMD);
+  vTaskDelay(1); // DREQ is low from the reset until the codec is ready again
+  if(!waitForCodec(AUDIO_MIDI_RESET_TIMEOUT_MS)){
+    Sprintln(F("Codec slow to reset after MIDI"));
+  }
+  spiBusAcquire(SPI_DEVICE_CODEC_CMD);
+  musicPlayer.sciWrite(VS1053_REG_CLOCKF, AUDIO_MIDI_CLOCKF);
+  musicPlayer.sciWrite(VS1053_REG_MODE, VS1053_MODE_SM_LINE1 | VS1053_MODE_SM_SDINEW); // as startPlaylist() sets it
+  spiBusRelease(SPI_DEVICE_CODEC_CMD);
+  current_program = -1;
+  Sprintln(F("MIDI mode ended"));
+}
@@ -0,0 +1,51 @@
+#ifndef AUDIO_MIDI_H
+#define AUDIO_MIDI_H
+
+#include <Arduino.h>
+#include <Adafruit_VS1053.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "spi-bus.h"
+#include "log.h"
+
+/*
+  Drives the VS1053's General MIDI synthesiser in real-time MIDI mode, so a chime can be described by a few notes in
+  an MQTT payload instead of a file on the SD card.
+
+  Real-time MIDI is started by loading VLSI's small rtmidi plugin over SCI; MIDI bytes are then sent on the data port,
+  each preceded by a zero byte. A soft reset leaves the mode and returns the codec to file decoding.
+  Only called from the audio task, which owns the codec. It runs above loopTask, so waits for the codec (DREQ) sleep a
+  tick at a time rather than spin, and the reset's wait is not spent holding the SPI bus.
+*/
+
+#define AUDIO_MIDI_MAX_NOTES 48       // fits a payload filling the MQTT client buffer
+#define AUDIO_MIDI_CHANNEL 0
+#define AUDIO_MIDI_CLOCKF 0x6000      // clock multiplier restored after leaving MIDI mode; as set by Adafruit_VS1053::begin()
+#define AUDIO_MIDI_READY_TIMEOUT_MS 10    // max wait for room for a MIDI message; the synth drains its input far faster than notes arrive
+#define AUDIO_MIDI_RESET_TIMEOUT_MS 100   // max wait for the codec after the soft reset; as Adafruit's softReset() delay()
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct audio_midi_note{
+  uint8_t program;                // General MIDI instrument, 0..127 (e.g. 14 tubular bells)
+  uint8_t note;                   // 0..127, 60 is middle C
+  uint8_t velocity;               // 1..127; 0 is a rest
+  uint16_t duration_ms;           // until the next note starts
+};
+
+struct audio_midi_sequence{
+  audio_midi_note notes[AUDIO_MIDI_MAX_NOTES];
+  uint8_t count = 0;
+};
+
+// *********************************************************************************************************************
+// *** Must Declare ***
+extern Adafruit_VS1053_FilePlayer musicPlayer;
+
+// Provided in library
+void midiBegin();                                               // load the real-time MIDI plugin
+void midiNoteOn(uint8_t program, uint8_t note, uint8_t velocity);   // program change is only sent when it differs
+void midiNoteOff(uint8_t note);
+void midiEnd();                                                 // silence all notes and return the codec to file decoding
+
+#endif
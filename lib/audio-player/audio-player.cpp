@@ -0,0 +1,828 @@
+#include "audio-player.h"
+
+/*
+  A source is one playlist entry that is (or is about to be) read into the read-ahead buffer.
+  Two are needed: the one being read and the next one, which is opened ahead of time.
+*/
+struct audio_source{
+  bool opened = false;
+  File file;                      // SD card source; used when data is NULL
+  bool stream = false;            // HTTP stream source; read from the jitter buffer
+  const uint8_t *data = NULL;     // whole file, mapped from the flash tone store or held by the tone cache
+  int cache_handle = -1;          // tone cache source, pinned while open
+  size_t size = 0;
+  size_t pos = 0;                 // read position in data
+  size_t loop_start = 0;          // file offset of the first byte of audio data; where a repeat rewinds to
+  long wav_length_field = -1;     // file offset of the WAV data chunk length, or -1
+  bool first_pass = true;
+  uint16_t plays_left = 1;        // 0 repeats until stopped
+  uint16_t gap_ms = 0;
+};
+
+static TaskHandle_t audio_task = NULL;
+static QueueHandle_t audio_commands = NULL;
+
+static volatile bool audio_playing = false;
+
+static ring_buffer readahead;
+static audio_source sources[2];
+static audio_source *reading = NULL;          // source currently being read into the read-ahead buffer; NULL once all are read
+static audio_source *upcoming = NULL;         // next source, already opened; NULL if there is none
+static audio_playlist *playlist = NULL;
+static char *stream_url = NULL;               // URL for the playlist's stream entry; owned by the audio task
+static uint8_t next_entry = 0;                // index in playlist of the entry to open after upcoming
+static size_t pad_remaining = 0;              // end fill bytes still to be written after a file
+static uint8_t end_fill_byte = 0;
+static uint16_t gap_pending = 0;              // gap to wait once the buffer has drained
+static unsigned long gap_until = 0;           // millis() at which a gap ends; 0 if not in a gap
+
+static uint32_t track_id = 0;                 // incremented on every start; stale duration timeouts are ignored
+static volatile uint32_t timer_track_id = 0;  // playlist the duration timer is currently armed for
+static esp_timer_handle_t duration_timer = NULL;
+
+static esp_timer_handle_t fade_timer = NULL;
+static uint8_t volume_target = 0;             // volume set by audioSetVolume(); what playback runs at outside of fades
+static uint8_t volume_now = 0;                // value last written to the codec volume register
+static bool fading = false;
+static uint8_t fade_from = 0;
+static uint8_t fade_to = 0;
+static int64_t fade_started = 0;              // esp_timer_get_time() at the start of the fade
+static int64_t fade_us = 0;
+static bool stop_after_fade = false;          // stop the playlist once the fade has finished
+
+static QueueHandle_t audio_summaries = NULL;
+static audio_playback_stats playback;         // measurements of the playlist being played
+static bool starving = false;                 // an underrun has been counted and nothing has been sent since
+static int64_t first_write_us = 0;            // esp_timer_get_time() of the playlist's first write to the codec; 0 before it
+static int64_t last_write_us = 0;             // ... of the latest write; 0 before the first and after a deliberate gap
+
+static audio_midi_sequence *midi = NULL;      // MIDI sequence playing in place of a playlist
+static uint8_t midi_next = 0;                 // index of the next note to start
+static int64_t midi_event_us = 0;             // esp_timer_get_time() at which the next note starts
+static int midi_sounding = -1;                // note to release when the next one starts, or -1
+static esp_timer_handle_t midi_timer = NULL;
+
+/*
+  DREQ goes high when the VS1053 has room for at least 32 more bytes.
+  Only wake the audio task here; SD and SPI access is not allowed in ISR context.
+*/
+static void IRAM_ATTR onDataRequest(){
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(audio_task, &woken);
+  if(woken == pdTRUE){
+    portYIELD_FROM_ISR();
+  }
+}
+
+void audioLock(){
+  spiBusAcquire(SPI_DEVICE_SD);
+}
+
+void audioUnlock(){
+  spiBusRelease(SPI_DEVICE_SD);
+}
+
+static void closeSource(audio_source *src){
+  if(src == NULL || !src->opened){
+    return;
+  }
+  if(src->stream){
+    streamClose();
+    src->stream = false;
+  }
+  else if(src->data != NULL){
+    if(src->cache_handle >= 0){
+      toneCacheRelease(src->cache_handle);
+      src->cache_handle = -1;
+    }
+    src->data = NULL;
+  }
+  else{
+    audioLock();
+    src->file.close();
+    audioUnlock();
+  }
+  src->opened = false;
+}
+
+/*
+  Open entry from the flash tone store, the tone cache, or the SD card if it is in neither, and locate the start of its audio data.
+  mp3 files start after the ID3 tag; WAV files are sent whole on the first pass (the decoder needs the header)
+  and rewind to the data chunk on a repeat. Offsets known from the tone index save reading the header, except for a stored tone,
+  which need not be the same file as the one indexed on the SD card.
+*/
+static bool openSource(audio_source *src, const audio_entry &entry){
+  src->first_pass = true;
+  src->plays_left = entry.repeat;
+  src->gap_ms = entry.gap_ms;
+  src->pos = 0;
+
+  if(entry.stream){
+    if(stream_url == NULL || !streamOpen(stream_url)){
+      Sprintln(F("Failed to open stream"));
+      return false;
+    }
+    Sprint(F("Opened stream: ")); Sprintln(stream_url);
+    src->stream = true;
+    src->cache_handle = -1;
+    src->size = 0; // unknown; a stream is never rewound
+    src->loop_start = 0;
+    src->wav_length_field = -1;
+    src->opened = true;
+    return true;
+  }
+
+  uint32_t data_offset = entry.data_offset;
+  int32_t wav_length_field = entry.wav_length_field;
+  // only WAV files are indexed with a data chunk length; anything else starts at its data offset
+  tone_codec codec = entry.wav_length_field >= 0 ? TONE_CODEC_WAV : TONE_CODEC_UNKNOWN;
+
+  src->cache_handle = -1;
+  src->data = NULL;
+  if(toneStoreFind(entry.path, &src->data, &src->size)){
+    Sprint(F("Opened from tone store: ")); Sprintln(entry.path);
+    codec = toneParseHeader(src->data, src->size, &data_offset, &wav_length_field);
+  }
+  else if((src->cache_handle = toneCacheAcquire(entry.path, &src->data, &src->size)) >= 0){
+    Sprint(F("Opened from tone cache: ")); Sprintln(entry.path);
+    if(entry.data_offset < 0){
+      codec = toneParseHeader(src->data, src->size, &data_offset, &wav_length_field);
+    }
+  }
+  else{
+    audioLock();
+    src->file = SD.open(entry.path);
+    if(!src->file){
+      audioUnlock();
+      Sprint(F("Failed to open: ")); Sprintln(entry.path);
+      return false;
+    }
+    if(entry.data_offset < 0){
+      uint8_t header[AUDIO_HEADER_PEEK];
+      int n = max((int)src->file.read(header, AUDIO_HEADER_PEEK), 0);
+      codec = toneParseHeader(header, n, &data_offset, &wav_length_field);
+    }
+    src->size = src->file.size();
+    audioUnlock();
+  }
+
+  data_offset = min((size_t)data_offset, src->size);
+  src->loop_start = data_offset;
+  src->wav_length_field = wav_length_field;
+  size_t start = codec == TONE_CODEC_WAV ? 0 : data_offset;
+  if(src->data != NULL){
+    src->pos = start;
+  }
+  else{
+    audioLock();
+    src->file.seek(start);
+    audioUnlock();
+  }
+  src->opened = true;
+  return true;
+}
+
+// Open the next playlist entry that can be opened into the free source slot
+static void openUpcoming(){
+  upcoming = NULL;
+  audio_source *slot = reading == &sources[0] ? &sources[1] : &sources[0];
+  while(playlist != NULL && next_entry < playlist->count){
+    const audio_entry &entry = playlist->entries[next_entry++];
+    if(openSource(slot, entry)){
+      upcoming = slot;
+      return;
+    }
+  }
+}
+
+// Make the upcoming source the one being read, and open the one after it
+static void advanceSource(){
+  reading = upcoming;
+  openUpcoming();
+}
+
+// Read up to len bytes of the source's audio data; returns 0 at the end of a pass
+static int readSource(audio_source *src, uint8_t *buf, size_t len){
+  if(src->data != NULL){
+    size_t n = min(len, src->size - src->pos);
+    memcpy(buf, src->data + src->pos, n);
+    src->pos += n;
+    return n;
+  }
+  audioLock();
+  int n = src->file.read(buf, len);
+  audioUnlock();
+  return n;
+}
+
+/*
+  A source has been read to the end. Either rewind it for another play, or close it and move on to the next entry:
+  immediately behind it in the buffer (gapless), or after the buffer has drained and the entry's gap has passed.
+*/
+static void endOfPass(audio_source *src){
+  src->first_pass = false;
+  if(src->plays_left != 1 && src->loop_start < src->size){
+    if(src->plays_left > 1){
+      src->plays_left--;
+    }
+    // gapless rewind within the open file or mapped/cached data
+    if(src->data != NULL){
+      src->pos = src->loop_start;
+    }
+    else{
+      audioLock();
+      src->file.seek(src->loop_start);
+      audioUnlock();
+    }
+    return;
+  }
+
+  uint16_t gap_ms = src->gap_ms;
+  closeSource(src);
+  pad_remaining = AUDIO_END_FILL_LEN;
+  if(gap_ms > 0 && upcoming != NULL){
+    reading = NULL;
+    gap_pending = gap_ms;
+  }
+  else{
+    advanceSource();
+  }
+}
+
+/*
+  Top up the read-ahead buffer with end fill bytes or a single AUDIO_SD_READ_BLOCK read.
+  Returns false if nothing was written (buffer full, or nothing left to read until the next gap ends).
+*/
+static bool fillReadahead(){
+  size_t len;
+  uint8_t *region = ringWriteRegion(readahead, &len);
+
+  if(pad_remaining > 0){
+    len = min(len, pad_remaining);
+    memset(region, end_fill_byte, len);
+    ringCommit(readahead, len);
+    pad_remaining -= len;
+    return len > 0;
+  }
+
+  if(reading == NULL || ringSpace(readahead) < AUDIO_SD_READ_BLOCK){
+    return false;
+  }
+  // region may be shorter than a block where the buffer wraps
+  len = min(len, (size_t)AUDIO_SD_READ_BLOCK);
+
+  audio_source *src = reading;
+  if(src->stream){
+    int n = streamRead(region, len);
+    if(n > 0){
+      ringCommit(readahead, n);
+      return true;
+    }
+    if(n < 0){
+      endOfPass(src);
+      return pad_remaining > 0 || reading != src;
+    }
+    return false; // jitter buffer refilling
+  }
+
+  size_t offset = src->data != NULL ? src->pos : src->file.position();
+  if(src->data == NULL){
+    // a read that starts mid-sector costs a single sector transfer for its head; end this one on a boundary so the rest are whole
+    len = min(len, AUDIO_SD_READ_BLOCK - offset % AUDIO_SD_SECTOR);
+  }
+  int n = readSource(src, region, len);
+
+  if(n > 0){
+    // a WAV that will be repeated gets a data chunk length covering every pass, so the decoder carries on across the rewinds
+    // and still ends with the last one, before whatever follows; open-ended (0xFFFFFFFF) if it repeats until stopped
+    if(src->first_pass && src->plays_left != 1 && src->wav_length_field >= 0){
+      uint32_t length = 0xFFFFFFFF;
+      if(src->plays_left > 1){
+        length = min((uint64_t)(src->size - src->loop_start) * src->plays_left, (uint64_t)0xFFFFFFFE);
+      }
+      for(long i = src->wav_length_field; i < src->wav_length_field + 4; i++){
+        if(i >= (long)offset && i < (long)(offset + n)){
+          region[i - offset] = length >> (8 * (i - src->wav_length_field)); // little endian
+        }
+      }
+    }
+    ringCommit(readahead, n);
+  }
+  if(n <= 0 || (size_t)n < len){
+    endOfPass(src);
+  }
+  return n > 0 || pad_remaining > 0 || reading != src;
+}
+
+static bool playlistFinished(){
+  return reading == NULL && upcoming == NULL && pad_remaining == 0 && gap_pending == 0 && gap_until == 0 && ringLevel(readahead) == 0;
+}
+
+static void freePlaylist(){
+  delete playlist;
+  playlist = NULL;
+  free(stream_url);
+  stream_url = NULL;
+}
+
+// Start measuring the playlist that has just been started
+static void beginPlayback(){
+  const audio_entry &first = playlist->entries[0];
+  playback = audio_playback_stats();
+  playback.track_id = track_id;
+  snprintf(playback.source, AUDIO_PATH_LEN, "%s", first.stream && stream_url != NULL ? stream_url : first.path);
+  starving = false;
+  first_write_us = 0;
+  last_write_us = 0;
+}
+
+static void countWrite(size_t len){
+  int64_t now = esp_timer_get_time();
+  if(first_write_us == 0){
+    first_write_us = now;
+  }
+  else if(last_write_us != 0){
+    int64_t gap_us = now - last_write_us;
+    playback.longest_gap_ms = max(playback.longest_gap_ms, (uint32_t)(gap_us / 1000));
+    // a gap longer than the codec's buffer lasts at the rate it is being drained means it ran dry while this task was held up
+    // (in a slow SD read, or behind another SPI user), even though the read-ahead buffer was never found empty. The initial
+    // burst that fills the codec skews the rate, so the first few buffers are not judged
+    int64_t elapsed_us = last_write_us - first_write_us;
+    if(!starving && playback.bytes > 4 * AUDIO_CODEC_FIFO_LEN && gap_us > AUDIO_CODEC_FIFO_LEN * elapsed_us / playback.bytes){
+      playback.underruns++;
+    }
+  }
+  last_write_us = now;
+  playback.bytes += len;
+  starving = false;
+}
+
+// Queue the summary of the playlist that has just ended for audioPlaybackSummary()
+static void endPlayback(bool stopped){
+  playback.stopped = stopped;
+  if(last_write_us > first_write_us){
+    playback.duration_ms = (last_write_us - first_write_us) / 1000;
+    playback.bitrate = (uint64_t)playback.bytes * 8 * 1000000 / (last_write_us - first_write_us);
+  }
+  if(xQueueSend(audio_summaries, &playback, 0) != pdTRUE){
+    Sprintln(F("Playback summary dropped"));
+  }
+}
+
+/*
+  Send 32 byte chunks to the codec for as long as DREQ stays high, all in one transaction on the data port: the bus is
+  claimed, clocked and selected once per burst rather than once per chunk.
+*/
+static void drainToCodec(){
+  uint8_t buf[VS1053_DATABUFFERLEN];
+  if(!musicPlayer.readyForData()){
+    return;
+  }
+  if(ringLevel(readahead) == 0){
+    if(reading != NULL && !starving){
+      // the codec wants more of an entry that has not been read yet
+      playback.underruns++;
+      starving = true;
+    }
+    return;
+  }
+
+  spiBusAcquire(SPI_DEVICE_CODEC_DATA);
+  spiBusBeginTransfer(SPI_DEVICE_CODEC_DATA);
+  while(musicPlayer.readyForData()){
+    int bytesread = ringRead(readahead, buf, VS1053_DATABUFFERLEN);
+    if(bytesread <= 0){
+      break; // caught up with the read-ahead buffer; checked again after the next block is read
+    }
+    spiBusWrite(buf, bytesread);
+    countWrite(bytesread);
+  }
+  spiBusEndTransfer(SPI_DEVICE_CODEC_DATA);
+  spiBusRelease(SPI_DEVICE_CODEC_DATA);
+}
+
+/*
+  Drain the read-ahead buffer to the codec for as long as it will accept data, then top up the buffer one block at a time,
+  draining again between blocks so the codec FIFO is never left waiting behind a long run of SD reads.
+  Returns once the codec is full and the read-ahead buffer is full (or the playlist has ended, or a gap has started).
+*/
+static void feedCodec(){
+  if(gap_until != 0){
+    if((long)(millis() - gap_until) < 0){
+      return;
+    }
+    gap_until = 0;
+    advanceSource();
+  }
+
+  while(audio_playing){
+    drainToCodec();
+
+    if(gap_pending > 0 && reading == NULL && pad_remaining == 0 && ringLevel(readahead) == 0){
+      // previous entry has been fully sent; wait out its gap before starting the next one
+      gap_until = millis() + gap_pending;
+      gap_pending = 0;
+      last_write_us = 0; // the gap is not a feed gap
+      break;
+    }
+    if(playlistFinished()){
+      audio_playing = false;
+      endPlayback(false);
+      freePlaylist();
+      break;
+    }
+    if(!fillReadahead()){
+      break; // nothing more to do until the next DREQ edge
+    }
+  }
+}
+
+static void writeVolume(uint8_t vol){
+  spiBusAcquire(SPI_DEVICE_CODEC_CMD);
+  musicPlayer.setVolume(vol, vol);
+  spiBusRelease(SPI_DEVICE_CODEC_CMD);
+  volume_now = vol;
+}
+
+static void cancelFade(){
+  esp_timer_stop(fade_timer); // harmless if not running
+  fading = false;
+  stop_after_fade = false;
+}
+
+// Ramp from the current volume to vol over fade_ms; immediate if fade_ms is 0
+static void startFade(uint8_t vol, uint16_t fade_ms){
+  esp_timer_stop(fade_timer);
+  if(fade_ms == 0 || vol == volume_now){
+    fading = false;
+    if(vol != volume_now){
+      writeVolume(vol);
+    }
+    return;
+  }
+  fading = true;
+  fade_from = volume_now;
+  fade_to = vol;
+  fade_started = esp_timer_get_time();
+  fade_us = (int64_t)fade_ms * 1000;
+  esp_timer_start_periodic(fade_timer, AUDIO_FADE_STEP_MS * 1000);
+}
+
+static void stopPlaylist();
+
+// Write the next step of a fade, and stop the playlist if the fade was a fade-out that has finished
+static void stepFade(){
+  if(!fading){
+    return;
+  }
+  int64_t elapsed = esp_timer_get_time() - fade_started;
+  uint8_t vol = fade_to;
+  if(elapsed < fade_us){
+    vol = fade_from + ((int)fade_to - fade_from) * elapsed / fade_us;
+  }
+  else{
+    esp_timer_stop(fade_timer);
+    fading = false;
+  }
+  if(vol != volume_now){
+    writeVolume(vol);
+  }
+  if(!fading && stop_after_fade){
+    stopPlaylist();
+  }
+}
+
+// Fade to silence, then stop; an immediate stop if fade_ms is 0 or nothing is playing
+static void fadeOutAndStop(uint16_t fade_ms){
+  if(fade_ms == 0 || !audio_playing){
+    stopPlaylist();
+    return;
+  }
+  startFade(AUDIO_VOLUME_SILENT, fade_ms);
+  stop_after_fade = fading;
+  if(!fading){
+    stopPlaylist(); // already silent
+  }
+}
+
+static void endMidi(){
+  esp_timer_stop(midi_timer); // harmless if not running
+  midiEnd();
+  delete midi;
+  midi = NULL;
+  midi_sounding = -1;
+  writeVolume(volume_target); // the soft reset leaves the codec at its default volume
+}
+
+static void stopPlaylist(){
+  esp_timer_stop(duration_timer); // harmless if not running
+  cancelFade();
+  if(midi != NULL){
+    endMidi();
+  }
+  else if(audio_playing){
+    // cancel all playback
+    spiBusAcquire(SPI_DEVICE_CODEC_CMD);
+    musicPlayer.sciWrite(VS1053_REG_MODE, VS1053_MODE_SM_LINE1 | VS1053_MODE_SM_SDINEW | VS1053_MODE_SM_CANCEL);
+    spiBusRelease(SPI_DEVICE_CODEC_CMD);
+  }
+  audio_playing = false;
+  closeSource(&sources[0]);
+  closeSource(&sources[1]);
+  reading = NULL;
+  upcoming = NULL;
+  pad_remaining = 0;
+  gap_pending = 0;
+  gap_until = 0;
+  ringReset(readahead);
+  if(playlist != NULL){
+    endPlayback(true);
+  }
+  freePlaylist();
+  // a fade-out or a fade-in that was cut short leaves the codec away from the level that was set
+  if(volume_now != volume_target){
+    writeVolume(volume_target);
+  }
+}
+
+// Runs in the esp_timer task every AUDIO_FADE_STEP_MS during a fade; the volume register is written by the audio task
+static void onFadeStep(void *arg){
+  xTaskNotifyGive(audio_task);
+}
+
+/*
+  Runs in the esp_timer task when a playlist's duration (less its fade-out) has elapsed. The stop itself is done by the audio task,
+  tagged with the playlist it was armed for in case another one has been started in the meantime.
+*/
+static void onDurationElapsed(void *arg){
+  audio_command cmd;
+  cmd.type = AUDIO_TIMEOUT;
+  cmd.track_id = timer_track_id;
+  xQueueSendToFront(audio_commands, &cmd, 0);
+  xTaskNotifyGive(audio_task);
+}
+
+/*
+  Mirrors Adafruit_VS1053_FilePlayer::startPlayingFile() without flagging musicPlayer.playingMusic,
+  so the Adafruit library never feeds the codec behind this task's back.
+*/
+static void startPlaylist(audio_playlist *pl, char *url){
+  stopPlaylist();
+  track_id++;
+  playlist = pl;
+  stream_url = url;
+  next_entry = 0;
+
+  // reset playback
+  spiBusAcquire(SPI_DEVICE_CODEC_CMD);
+  musicPlayer.sciWrite(VS1053_REG_MODE, VS1053_MODE_SM_LINE1 | VS1053_MODE_SM_SDINEW);
+  // resync
+  musicPlayer.sciWrite(VS1053_REG_WRAMADDR, 0x1e29);
+  musicPlayer.sciWrite(VS1053_REG_WRAM, 0);
+  // byte the decoder expects to be padded with after a file
+  musicPlayer.sciWrite(VS1053_REG_WRAMADDR, 0x1e06);
+  end_fill_byte = musicPlayer.sciRead(VS1053_REG_WRAM) & 0xFF;
+  spiBusRelease(SPI_DEVICE_CODEC_CMD);
+
+  openUpcoming();
+  advanceSource();
+  if(reading == NULL){
+    Sprintln(F("Nothing to play"));
+    beginPlayback();
+    playback.failed = true;
+    endPlayback(false);
+    freePlaylist();
+    return;
+  }
+  beginPlayback();
+  fillReadahead();
+
+  // don't let the IRQ get triggered by accident here
+  unsigned long started = millis();
+  while(!musicPlayer.readyForData() && millis() - started < AUDIO_READY_TIMEOUT_MS){
+    vTaskDelay(1);
+  }
+
+  if(playlist->duration_ms > 0){
+    // the fade-out is part of the duration
+    uint32_t until_fade_ms = playlist->duration_ms - min((uint32_t)playlist->fade_out_ms, playlist->duration_ms);
+    timer_track_id = track_id;
+    esp_timer_start_once(duration_timer, (uint64_t)max(until_fade_ms, (uint32_t)1) * 1000);
+  }
+
+  if(playlist->fade_in_ms > 0){
+    writeVolume(AUDIO_VOLUME_SILENT);
+  }
+  audio_playing = true;
+  startFade(volume_target, playlist->fade_in_ms);
+  feedCodec();
+}
+
+// Runs in the esp_timer task when the next MIDI note is due; the note is sent by the audio task
+static void onMidiStep(void *arg){
+  xTaskNotifyGive(audio_task);
+}
+
+/*
+  Release the sounding note and start the next one once it is due, then arm the timer for the one after.
+  Note times are accumulated from the start of the sequence, so they do not drift with wake-up latency.
+*/
+static void stepMidi(){
+  if(midi == NULL || esp_timer_get_time() < midi_event_us){
+    return;
+  }
+  if(midi_sounding >= 0){
+    midiNoteOff(midi_sounding);
+    midi_sounding = -1;
+  }
+  if(midi_next >= midi->count){
+    Sprintln(F("MIDI sequence finished"));
+    endMidi();
+    audio_playing = false;
+    return;
+  }
+
+  const audio_midi_note &note = midi->notes[midi_next++];
+  if(note.velocity > 0){
+    midiNoteOn(note.program, note.note, note.velocity);
+    midi_sounding = note.note;
+  }
+  midi_event_us += (int64_t)note.duration_ms * 1000;
+  esp_timer_start_once(midi_timer, max(midi_event_us - esp_timer_get_time(), (int64_t)1));
+}
+
+static void startMidi(audio_midi_sequence *seq){
+  stopPlaylist();
+  track_id++;
+  midi = seq;
+  midi_next = 0;
+  midi_sounding = -1;
+
+  midiBegin();
+  writeVolume(volume_target);
+  audio_playing = true;
+  midi_event_us = esp_timer_get_time();
+  stepMidi();
+}
+
+static void handleCommand(const audio_command &cmd){
+  switch(cmd.type){
+    case AUDIO_PLAY:
+      startPlaylist(cmd.playlist, cmd.url);
+      break;
+    case AUDIO_MIDI:
+      startMidi(cmd.midi);
+      break;
+    case AUDIO_STOP:
+      fadeOutAndStop(cmd.fade_ms);
+      break;
+    case AUDIO_VOLUME:
+      volume_target = cmd.volume;
+      // a fade-out in progress carries on; the new volume applies once it has stopped
+      if(!stop_after_fade){
+        startFade(cmd.volume, audio_playing ? cmd.fade_ms : 0);
+      }
+      break;
+    case AUDIO_TIMEOUT:
+      if(cmd.track_id == track_id && audio_playing){
+        Sprintln(F("Duration elapsed"));
+        fadeOutAndStop(playlist != NULL ? playlist->fade_out_ms : 0);
+      }
+      break;
+  }
+}
+
+static void audioTask(void *param){
+  audio_command cmd;
+  for(;;){
+    // sleep until DREQ edge or a new command; while playing, never sleep longer than AUDIO_FEED_TIMEOUT_MS
+    ulTaskNotifyTake(pdTRUE, audio_playing ? pdMS_TO_TICKS(AUDIO_FEED_TIMEOUT_MS) : portMAX_DELAY);
+
+    while(xQueueReceive(audio_commands, &cmd, 0) == pdTRUE){
+      handleCommand(cmd);
+    }
+    stepFade();
+    stepMidi();
+
+    if(audio_playing && midi == NULL){
+      feedCodec();
+    }
+  }
+}
+
+static bool queueCommand(const audio_command &cmd){
+  if(audio_task == NULL){
+    return false;
+  }
+  if(xQueueSend(audio_commands, &cmd, 0) != pdTRUE){
+    Sprintln(F("Audio command queue full!"));
+    return false;
+  }
+  xTaskNotifyGive(audio_task);
+  return true;
+}
+
+bool initAudioPlayer(uint8_t dreq_pin, size_t readahead_size){
+  audio_commands = xQueueCreate(AUDIO_COMMAND_QUEUE_LEN, sizeof(audio_command));
+  audio_summaries = xQueueCreate(AUDIO_SUMMARY_QUEUE_LEN, sizeof(audio_playback_stats));
+  if(audio_commands == NULL || audio_summaries == NULL){
+    return false;
+  }
+
+  esp_timer_create_args_t timer_args = {};
+  timer_args.callback = onDurationElapsed;
+  timer_args.name = "duration";
+  if(esp_timer_create(&timer_args, &duration_timer) != ESP_OK){
+    return false;
+  }
+  timer_args.callback = onFadeStep;
+  timer_args.name = "fade";
+  if(esp_timer_create(&timer_args, &fade_timer) != ESP_OK){
+    return false;
+  }
+  timer_args.callback = onMidiStep;
+  timer_args.name = "midi";
+  if(esp_timer_create(&timer_args, &midi_timer) != ESP_OK){
+    return false;
+  }
+  volume_now = volume_target = musicPlayer.sciRead(VS1053_REG_VOLUME) & 0xFF;
+
+  // whole blocks only, and at least two so one can be drained while the next is read
+  readahead_size = max(readahead_size - readahead_size % AUDIO_SD_READ_BLOCK, (size_t)(2 * AUDIO_SD_READ_BLOCK));
+  if(!ringInit(readahead, readahead_size, false)){
+    return false;
+  }
+
+  if(xTaskCreate(audioTask, "audio", AUDIO_TASK_STACK, NULL, AUDIO_TASK_PRIORITY, &audio_task) != pdPASS){
+    audio_task = NULL;
+    return false;
+  }
+
+  attachInterrupt(digitalPinToInterrupt(dreq_pin), onDataRequest, RISING);
+  return true;
+}
+
+bool audioPlay(const audio_playlist &pl, const char *url){
+  audio_command cmd;
+  cmd.type = AUDIO_PLAY;
+  cmd.playlist = new audio_playlist(pl);
+  cmd.url = url != NULL ? strdup(url) : NULL;
+  if(!queueCommand(cmd)){
+    delete cmd.playlist;
+    free(cmd.url);
+    return false;
+  }
+  return true;
+}
+
+bool audioPlay(const char *path, uint32_t duration_ms){
+  audio_playlist pl;
+  strncpy(pl.entries[0].path, path, AUDIO_PATH_LEN - 1);
+  pl.entries[0].path[AUDIO_PATH_LEN - 1] = '\0';
+  pl.entries[0].repeat = duration_ms > 0 ? 0 : 1; // loop until duration elapses
+  pl.count = 1;
+  pl.duration_ms = duration_ms;
+  return audioPlay(pl);
+}
+
+bool audioPlayMidi(const audio_midi_sequence &sequence){
+  audio_command cmd;
+  cmd.type = AUDIO_MIDI;
+  cmd.midi = new audio_midi_sequence(sequence);
+  if(!queueCommand(cmd)){
+    delete cmd.midi;
+    return false;
+  }
+  return true;
+}
+
+bool audioStop(uint16_t fade_ms){
+  audio_command cmd;
+  cmd.type = AUDIO_STOP;
+  cmd.fade_ms = fade_ms;
+  return queueCommand(cmd);
+}
+
+bool audioSetVolume(uint8_t vol, uint16_t fade_ms){
+  audio_command cmd;
+  cmd.type = AUDIO_VOLUME;
+  cmd.volume = vol;
+  cmd.fade_ms = fade_ms;
+  return queueCommand(cmd);
+}
+
+bool audioIsPlaying(){
+  return audio_playing;
+}
+
+size_t audioBufferLevel(){
+  return ringLevel(readahead);
+}
+
+size_t audioBufferSize(){
+  return readahead.size;
+}
+
+bool audioPlaybackSummary(audio_playback_stats &stats){
+  return audio_summaries != NULL && xQueueReceive(audio_summaries, &stats, 0) == pdTRUE;
+}
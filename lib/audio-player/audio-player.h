@@ -0,0 +1,146 @@
+#ifndef AUDIO_PLAYER_H
+#define AUDIO_PLAYER_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include <Adafruit_VS1053.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "tone-cache.h"
+#include "tone-store.h"
+#include "tone-index.h"
+#include "ring-buffer.h"
+#include "audio-stream.h"
+#include "audio-midi.h"
+#include "spi-bus.h"
+#include "log.h"
+
+/*
+  Owns the SD --> VS1053 pipeline from a dedicated FreeRTOS task.
+
+  The Adafruit library's useInterrupt(VS1053_FILEPLAYER_PIN_INT) calls feedBuffer() from inside the DREQ interrupt handler, which
+  performs SD and SPI transactions in ISR context and resets the ESP32 as soon as audio starts. Instead, the DREQ rising edge only
+  notifies the audio task, and the task (running above loopTask priority) does all of the feeding. Playback therefore no longer
+  depends on how long mqttclient.loop(), assertConnectivity() or a display flush takes in loop().
+
+  The main program never touches the codec data port or the open track directly; it queues commands with audioPlay(), audioStop()
+  and audioSetVolume(). Any other SD card access from the main program must be wrapped in audioLock()/audioUnlock(), which
+  claim the shared SPI bus for the SD card (see spi-bus.h); keep each claim to a batch so the audio task can get in between.
+
+  Tones in the flash tone store (see tone-store.h) are read in place from the mapped partition, and those held by the tone
+  cache (see tone-cache.h) straight from PSRAM; the SD card is only opened when a tone is in neither.
+  Everything sent to the codec goes through a read-ahead ring buffer: it is filled with large multi-block reads (AUDIO_SD_READ_BLOCK,
+  kept sector aligned so the card streams whole sectors) and drained to the codec whenever DREQ is high, in 32 byte chunks
+  within a single transaction on the data port, instead of one small SD read per codec write.
+
+  A playlist entry may instead be an HTTP stream (see audio-stream.h); it is read from the stream's jitter buffer rather than
+  the SD card, and while that buffer is refilling the codec is simply not fed.
+
+  Entries looked up in the tone index (see tone-index.h) carry the offset of their audio data, so they are opened and seeked to
+  directly; otherwise the start of the file is read to locate it.
+
+  Playback is driven by a playlist (a single tone is a playlist of one). The entry after the one being read is opened ahead of time,
+  and as soon as the current file has been read to the end the next one continues filling the same buffer behind it, separated
+  only by the decoder's end fill bytes, so transitions are gapless. An entry with gap_ms instead lets the buffer drain and waits.
+  A repeated entry (or a single tone with a duration) is rewound to the start of its audio data rather than closed and reopened.
+  WAV files that will repeat are sent with a data chunk length covering all of their passes, so the decoder does not stop after
+  the first pass but does stop before the next entry; it is open-ended only for an entry that repeats until stopped.
+  The duration of the whole playlist is enforced by an esp_timer, independently of loop() timing.
+
+  A MIDI sequence (see audio-midi.h) takes the place of a playlist: the codec is switched to real-time MIDI mode and the
+  audio task sends each note on a one-shot esp_timer, then switches back. It is stopped, faded and arbitrated like a playlist.
+
+  Volume changes, fade-ins and fade-outs are ramped by the audio task: a periodic esp_timer wakes it every AUDIO_FADE_STEP_MS
+  and it writes the next step to the codec volume register between feeds. The attenuation is stepped linearly, which is
+  linear in dB. A stop with a fade (or a playlist reaching its duration with fade_out_ms) only cancels the decoder once
+  the fade has reached silence, and the volume is then restored for the next playlist.
+
+  Every playlist is measured while it plays: bytes sent to the codec, underruns, the longest interval between writes to the
+  codec and the effective bit rate. An underrun is DREQ high with nothing in the read-ahead buffer to send, or a gap between
+  writes longer than the codec's own buffer lasts at the rate it has been drained so far. When it ends, however it
+  ends, the summary is queued for the main program to collect with audioPlaybackSummary(), e.g. to publish alongside
+  Wi-Fi and broker diagnostics. A playlist none of whose entries could be opened is summarised too, as failed: it never
+  plays, so audioIsPlaying() does not change and the summary is the only sign that it has come to an end. Gaps between entries (gap_ms) are deliberate and are not counted.
+*/
+
+#define AUDIO_TASK_PRIORITY 5         // loopTask runs at 1; keep the codec fed ahead of wifi/mqtt/display work
+#define AUDIO_TASK_STACK 4096         // bytes
+#define AUDIO_COMMAND_QUEUE_LEN 8
+#define AUDIO_SUMMARY_QUEUE_LEN 4     // playback summaries waiting for the main program; older ones are dropped
+#define AUDIO_FEED_TIMEOUT_MS 10      // safety net; feed at least this often while playing in case a DREQ edge is missed
+#define AUDIO_READY_TIMEOUT_MS 250    // max wait for DREQ after (re)starting the decoder
+#define AUDIO_PATH_LEN 64             // /tones/12345678.123 fits comfortably
+#define AUDIO_SD_READ_BLOCK 4096      // bytes per SD read when filling the read-ahead buffer; multiple of the 512 byte sector size
+#define AUDIO_SD_SECTOR 512           // reads are shortened to end on a sector boundary so the next one starts on one
+#define AUDIO_MAX_SEQUENCE 8          // entries in a playlist
+#define AUDIO_END_FILL_LEN 2052       // end fill bytes sent after each file so the decoder finishes it before the next begins
+#define AUDIO_CODEC_FIFO_LEN 2048     // VS1053 stream buffer; how far ahead of playback the codec can be fed
+#define AUDIO_HEADER_PEEK 512         // bytes read at open time to locate the start of audio data
+#define AUDIO_FADE_STEP_MS 10         // interval between volume register writes while fading
+#define AUDIO_VOLUME_SILENT 0xFE      // VS1053 attenuation that fades start from and end at; 0xFF would power down the analog output
+
+// *********************************************************************************************************************
+// *** Data Types ***
+enum audio_command_type { AUDIO_PLAY, AUDIO_MIDI, AUDIO_STOP, AUDIO_VOLUME, AUDIO_TIMEOUT };
+
+struct audio_entry{
+  char path[AUDIO_PATH_LEN];      // full path on SD card
+  uint16_t repeat = 1;            // times to play; 0 repeats until stopped (or the playlist duration elapses)
+  uint16_t gap_ms = 0;            // silence after this entry before the next; 0 is gapless
+  int32_t data_offset = -1;       // start of audio data from the tone index; -1 locates it from the file header when opened
+  int32_t wav_length_field = -1;  // offset of the WAV data chunk length from the tone index, or -1
+  bool stream = false;            // play the playlist's stream URL instead of path; at most one per playlist
+};
+
+struct audio_playlist{
+  audio_entry entries[AUDIO_MAX_SEQUENCE];
+  uint8_t count = 0;
+  uint32_t duration_ms = 0;       // 0 plays the playlist once, otherwise stop when duration elapses
+  uint16_t fade_in_ms = 0;        // ramp up from silence when playback starts
+  uint16_t fade_out_ms = 0;       // ramp down to silence before stopping when duration elapses (included in the duration)
+};
+
+struct audio_command{
+  audio_command_type type;
+  audio_playlist *playlist;       // AUDIO_PLAY only; allocated by sender, freed by audio task
+  char *url;                      // AUDIO_PLAY only; stream URL for a stream entry, or NULL. allocated by sender, freed by audio task
+  audio_midi_sequence *midi;      // AUDIO_MIDI only; allocated by sender, freed by audio task
+  uint8_t volume;                 // AUDIO_VOLUME only; VS1053 attenuation, 0 is loudest
+  uint16_t fade_ms;               // AUDIO_VOLUME and AUDIO_STOP; ramp to the new volume, or to silence before stopping
+  uint32_t track_id;              // AUDIO_TIMEOUT only; playlist the duration timer was armed for
+};
+
+struct audio_playback_stats{
+  uint32_t track_id = 0;
+  char source[AUDIO_PATH_LEN] = "";   // first entry's path, or its stream URL (truncated)
+  bool stopped = false;           // cut short by a stop, its duration or another playlist, rather than played to the end
+  bool failed = false;            // nothing in it could be opened (or the stream started); it never played
+  uint32_t bytes = 0;             // sent to the codec, including end fill
+  uint32_t underruns = 0;         // times the codec asked for data with the read-ahead buffer empty, or was fed too late
+  uint32_t longest_gap_ms = 0;    // longest interval between writes to the codec
+  uint32_t duration_ms = 0;       // first write to last write
+  uint32_t bitrate = 0;           // bits/s over duration_ms
+};
+
+// *********************************************************************************************************************
+// *** Must Declare ***
+extern Adafruit_VS1053_FilePlayer musicPlayer;
+
+// Provided in library
+bool initAudioPlayer(uint8_t dreq_pin, size_t readahead_size); // start audio task and attach DREQ interrupt; call after musicPlayer.begin(), initSpiBus() and SD.begin()
+bool audioPlay(const char *path, uint32_t duration_ms); // queue playback of file, looped for duration_ms if > 0; replaces anything currently playing
+bool audioPlay(const audio_playlist &playlist, const char *url = NULL); // queue playback of playlist (url for its stream entry, if any); replaces anything currently playing
+bool audioPlayMidi(const audio_midi_sequence &sequence);  // queue a MIDI note sequence; replaces anything currently playing
+bool audioStop(uint16_t fade_ms = 0);    // queue stop, fading out first if fade_ms > 0; no-op if nothing is playing
+bool audioSetVolume(uint8_t vol, uint16_t fade_ms = 0); // queue volume change, ramped over fade_ms while playing; lower numbers == louder volume
+bool audioIsPlaying();                    // true from the moment a playlist (or MIDI sequence) starts until its last entry ends or it is stopped
+size_t audioBufferLevel();                // bytes waiting in the read-ahead buffer
+size_t audioBufferSize();                 // capacity of the read-ahead buffer
+bool audioPlaybackSummary(audio_playback_stats &stats);  // next summary of a finished playlist, oldest first; false if none
+void audioLock();                         // claim the SPI bus for SD card access made outside the audio task
+void audioUnlock();
+
+#endif
@@ -0,0 +1,188 @@
+#include "audio-stream.h"
+
+struct stream_request{
+  uint32_t generation;
+  char url[AUDIO_URL_LEN];
+};
+
+static TaskHandle_t stream_task = NULL;
+static QueueHandle_t requests = NULL;         // stream_request, to the download task; only the latest matters
+static ring_buffer jitter;
+static audio_stream_stats stats;
+
+// set by the audio task: the stream it has open (or last had); a download for any other generation stops
+static volatile uint32_t open_generation = 0;
+// set by the download task
+static volatile uint32_t fetch_generation = 0;  // whose data the jitter buffer holds; set once it has been emptied for it
+static volatile uint32_t done_generation = 0;   // no more data will be written to the jitter buffer for this one
+
+// audio task only
+static bool opened = false;
+static bool buffering = false;                // holding back data until the jitter buffer reaches jitterLevel()
+static unsigned long rate_started = 0;        // millis() at the start of the current rate measurement
+static uint32_t rate_bytes = 0;
+
+// Bytes the jitter buffer is filled to before data is handed out
+static size_t jitterLevel(){
+  uint32_t bitrate = stats.bitrate > 0 ? stats.bitrate : AUDIO_STREAM_DEFAULT_BITRATE;
+  size_t level = (uint64_t)bitrate / 8 * AUDIO_STREAM_JITTER_MS / 1000;
+  return constrain(level, (size_t)AUDIO_STREAM_MIN_PREBUFFER, jitter.size / 2);
+}
+
+static void fetch(const stream_request &req){
+  const char *stream_url = req.url;
+  HTTPClient http;
+  http.useHTTP10(true); // no chunked transfer encoding; the body is the audio data as-is
+  http.setConnectTimeout(AUDIO_STREAM_TIMEOUT_MS);
+  http.setTimeout(AUDIO_STREAM_TIMEOUT_MS);
+
+  Sprint(F("Stream connecting: ")); Sprintln(stream_url);
+  if(!http.begin(stream_url)){
+    Sprintln(F("Invalid stream URL"));
+    return;
+  }
+  int code = http.GET();
+  if(code != HTTP_CODE_OK){
+    Sprint(F("Stream request failed: ")); Sprintln(code);
+    http.end();
+    return;
+  }
+
+  WiFiClient *client = http.getStreamPtr();
+  int remaining = http.getSize(); // -1 if the server did not send a length
+  unsigned long last_data = millis();
+  while(req.generation == open_generation && remaining != 0){
+    size_t len;
+    uint8_t *region = ringWriteRegion(jitter, &len);
+    int available = client->available();
+    if(len == 0 || available <= 0){
+      if(len > 0 && !client->connected()){
+        break; // server closed the connection; everything has been read
+      }
+      if(len > 0 && millis() - last_data > AUDIO_STREAM_TIMEOUT_MS){
+        Sprintln(F("Stream timed out"));
+        break;
+      }
+      if(len == 0){
+        last_data = millis(); // buffer full; waiting on the codec, not the server
+      }
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+    if(remaining > 0){
+      len = min(len, (size_t)remaining);
+    }
+    int n = client->read(region, min(len, (size_t)available));
+    if(n > 0){
+      ringCommit(jitter, n);
+      last_data = millis();
+      if(remaining > 0){
+        remaining -= n;
+      }
+    }
+  }
+  http.end();
+}
+
+/*
+  A stream opened while the previous one is still winding down (a stream replacing a stream) waits in the request queue
+  until that download has ended, so the jitter buffer is only ever emptied here, between downloads, and streamRead()
+  holds off until it has been emptied for the stream the audio task now has open.
+*/
+static void streamTask(void *param){
+  static stream_request req; // off the task's stack
+  for(;;){
+    if(xQueueReceive(requests, &req, portMAX_DELAY) != pdTRUE || req.generation != open_generation){
+      continue; // superseded, or closed, before it was started
+    }
+    ringReset(jitter); // nothing is reading: streamRead() waits for fetch_generation
+    fetch_generation = req.generation;
+    fetch(req);
+    done_generation = req.generation;
+    Sprintln(F("Stream fetch finished"));
+  }
+}
+
+bool initAudioStream(size_t jitter_size){
+  if(!ringInit(jitter, jitter_size, true)){
+    Sprintln(F("No memory for stream jitter buffer"));
+    return false;
+  }
+  requests = xQueueCreate(1, sizeof(stream_request));
+  if(requests == NULL
+    || xTaskCreate(streamTask, "stream", AUDIO_STREAM_TASK_STACK, NULL, AUDIO_STREAM_TASK_PRIORITY, &stream_task) != pdPASS){
+    stream_task = NULL;
+    return false;
+  }
+  return true;
+}
+
+bool streamOpen(const char *url){
+  if(stream_task == NULL || url == NULL || strlen(url) >= AUDIO_URL_LEN){
+    return false;
+  }
+  static stream_request req; // off the audio task's stack
+  xQueueReceive(requests, &req, 0); // a request the download task has not started yet is superseded
+  req.generation = ++open_generation; // stops the download of any previous stream
+  strcpy(req.url, url);
+  if(xQueueSend(requests, &req, 0) != pdPASS){
+    return false;
+  }
+
+  opened = true;
+  buffering = true;
+  stats.bytes = 0;
+  return true;
+}
+
+int streamRead(uint8_t *buf, size_t len){
+  if(!opened){
+    return -1;
+  }
+  if(fetch_generation != open_generation){
+    return 0; // the previous stream's download is still winding down
+  }
+  bool fetch_done = done_generation == open_generation;
+  size_t level = ringLevel(jitter);
+  if(buffering){
+    if(level < jitterLevel() && !fetch_done){
+      return 0;
+    }
+    buffering = false;
+    rate_started = millis();
+    rate_bytes = 0;
+  }
+  if(level == 0){
+    if(fetch_done){
+      return -1;
+    }
+    stats.underruns++;
+    buffering = true;
+    Sprintln(F("Stream underrun"));
+    return 0;
+  }
+
+  size_t n = ringRead(jitter, buf, len);
+  stats.bytes += n;
+  rate_bytes += n;
+  // the codec paces consumption, so bytes read over time is the stream's bit rate
+  unsigned long elapsed = millis() - rate_started;
+  if(elapsed >= AUDIO_STREAM_RATE_WINDOW_MS){
+    stats.bitrate = (uint64_t)rate_bytes * 8 * 1000 / elapsed;
+    rate_started = millis();
+    rate_bytes = 0;
+  }
+  return n;
+}
+
+void streamClose(){
+  if(!opened){
+    return;
+  }
+  opened = false;
+  open_generation++; // stops the download
+}
+
+const audio_stream_stats &audioStreamStats(){
+  return stats;
+}
@@ -0,0 +1,52 @@
+#ifndef AUDIO_STREAM_H
+#define AUDIO_STREAM_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "ring-buffer.h"
+#include "log.h"
+
+/*
+  Fetches audio over HTTP (for example a Home Assistant media URL or a TTS server on the LAN) into a PSRAM jitter buffer,
+  from which the audio task reads it like any other source.
+
+  The download runs in its own task so that a slow or stalled connection never holds up the audio task. The audio task
+  only sees the jitter buffer: nothing is handed out until it holds AUDIO_STREAM_JITTER_MS of audio (at the measured bit
+  rate, AUDIO_STREAM_DEFAULT_BITRATE until one has been measured), and if it ever runs dry before the download has
+  finished that is counted as an underrun and the buffer is refilled to the same level before playback continues.
+
+  A stream can be opened while the previous one's download is still winding down (one stream replacing another): the
+  new one is started by the download task as soon as the old one has ended, and reads as buffering until then.
+
+  The request is made as HTTP/1.0 so the server cannot answer with a chunked body. Only http:// URLs are supported.
+*/
+
+#define AUDIO_STREAM_TASK_PRIORITY 3          // below the audio task, above loopTask
+#define AUDIO_STREAM_TASK_STACK 6144          // bytes; HTTPClient and lwIP calls
+#define AUDIO_URL_LEN 256
+#define AUDIO_STREAM_TIMEOUT_MS 5000          // connect timeout, and longest silence from the server before giving up
+#define AUDIO_STREAM_JITTER_MS 750            // audio held in the jitter buffer before starting, and after an underrun
+#define AUDIO_STREAM_MIN_PREBUFFER 4096       // bytes; lower bound of the jitter level for very low bit rates
+#define AUDIO_STREAM_DEFAULT_BITRATE 128000   // bits/s assumed until the consumption rate has been measured
+#define AUDIO_STREAM_RATE_WINDOW_MS 2000      // interval over which the consumption rate is measured
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct audio_stream_stats{
+  uint32_t underruns = 0;         // times the jitter buffer ran dry mid-stream, since boot
+  uint32_t bitrate = 0;           // bits/s consumed by the codec, last measured
+  uint32_t bytes = 0;             // bytes of the current (or last) stream handed to the codec
+};
+
+// Provided in library
+bool initAudioStream(size_t jitter_size);                 // allocate the jitter buffer in PSRAM and start the download task
+bool streamOpen(const char *url);                         // audio task only; start fetching url, once any previous fetch has ended
+int streamRead(uint8_t *buf, size_t len);                 // audio task only; bytes read, 0 while buffering, -1 once the stream has ended
+void streamClose();                                       // audio task only; abandon the current stream
+const audio_stream_stats &audioStreamStats();
+
+#endif
@@ -0,0 +1,71 @@
+#include "ring-buffer.h"
+
+bool ringInit(ring_buffer &rb, size_t size, bool use_psram){
+  // round down to a power of two so positions stay continuous when the byte counters wrap
+  while(size & (size - 1)){
+    size &= size - 1;
+  }
+  rb.data = (uint8_t *)(use_psram ? ps_malloc(size) : malloc(size));
+  rb.size = rb.data != NULL ? size : 0;
+  rb.written = 0;
+  rb.consumed = 0;
+  return rb.data != NULL;
+}
+
+void ringReset(ring_buffer &rb){
+  rb.written = 0;
+  rb.consumed = 0;
+}
+
+size_t ringLevel(const ring_buffer &rb){
+  size_t level = rb.written - rb.consumed;
+  __atomic_thread_fence(__ATOMIC_ACQUIRE); // data behind the counters is read after them
+  return level;
+}
+
+size_t ringSpace(const ring_buffer &rb){
+  return rb.size - ringLevel(rb);
+}
+
+uint8_t *ringWriteRegion(ring_buffer &rb, size_t *len){
+  size_t pos = rb.written & (rb.size - 1);
+  *len = min(ringSpace(rb), rb.size - pos);
+  return rb.data + pos;
+}
+
+void ringCommit(ring_buffer &rb, size_t len){
+  __atomic_thread_fence(__ATOMIC_RELEASE); // data is visible before the counter that publishes it
+  rb.written += len;
+}
+
+size_t ringWrite(ring_buffer &rb, const uint8_t *src, size_t len){
+  size_t total = 0;
+  while(total < len){
+    size_t region_len;
+    uint8_t *region = ringWriteRegion(rb, &region_len);
+    if(region_len == 0){
+      break;
+    }
+    size_t n = min(region_len, len - total);
+    memcpy(region, src + total, n);
+    ringCommit(rb, n);
+    total += n;
+  }
+  return total;
+}
+
+size_t ringRead(ring_buffer &rb, uint8_t *dst, size_t len){
+  size_t total = 0;
+  while(total < len){
+    size_t pos = rb.consumed & (rb.size - 1);
+    size_t n = min(min(ringLevel(rb), rb.size - pos), len - total);
+    if(n == 0){
+      break;
+    }
+    memcpy(dst + total, rb.data + pos, n);
+    __atomic_thread_fence(__ATOMIC_RELEASE); // copied out before the space is handed back
+    rb.consumed += n;
+    total += n;
+  }
+  return total;
+}
@@ -0,0 +1,34 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <Arduino.h>
+
+/*
+  Byte ring buffer for exactly one producer and one consumer, which may be different tasks.
+  The producer only advances 'written' and the consumer only advances 'consumed', so no lock is needed. Fences keep the
+  data ordered against the counters where the two sides run on different cores (the host simulator).
+
+  Producers that read from a device (SD card, network) should use ringWriteRegion()/ringCommit() so the device reads
+  directly into the buffer without an intermediate copy.
+*/
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct ring_buffer{
+  uint8_t *data = NULL;
+  size_t size = 0;
+  volatile size_t written = 0;    // total bytes ever written; only advanced by producer
+  volatile size_t consumed = 0;   // total bytes ever read; only advanced by consumer
+};
+
+// Provided in library
+bool ringInit(ring_buffer &rb, size_t size, bool use_psram);          // allocate storage; size is rounded down to a power of two
+void ringReset(ring_buffer &rb);                                      // discard contents; only when neither side is active
+size_t ringLevel(const ring_buffer &rb);                              // bytes available to read
+size_t ringSpace(const ring_buffer &rb);                              // bytes available to write
+uint8_t *ringWriteRegion(ring_buffer &rb, size_t *len);               // contiguous free space at write position
+void ringCommit(ring_buffer &rb, size_t len);                         // mark len bytes of the write region as written
+size_t ringWrite(ring_buffer &rb, const uint8_t *src, size_t len);    // copy in as much as fits; returns bytes written
+size_t ringRead(ring_buffer &rb, uint8_t *dst, size_t len);           // copy out up to len bytes; returns bytes read
+
+#endif
@@ -0,0 +1,113 @@
+#include "spi-bus.h"
+
+static SemaphoreHandle_t bus_mutex = NULL;
+static int8_t codec_dcs = -1;
+static SPISettings codec_data_settings(SPI_BUS_CODEC_DATA_HZ, MSBFIRST, SPI_MODE0);
+
+// only changed by the task holding bus_mutex
+static int depth = 0;                         // nesting of the current holder's claims
+static spi_device holder = SPI_DEVICE_SD;     // device of the outermost claim
+static int64_t held_since = 0;
+static spi_device_usage usage[SPI_DEVICE_COUNT];
+static int64_t peak_wait_us[SPI_DEVICE_COUNT];  // longest wait since the previous spiBusSample()
+
+// totals at the previous spiBusSample()
+static spi_device_usage sampled[SPI_DEVICE_COUNT];
+static int64_t sampled_at = 0;
+
+bool initSpiBus(int8_t codec_dcs_pin){
+  bus_mutex = xSemaphoreCreateRecursiveMutex();
+  if(bus_mutex == NULL){
+    return false;
+  }
+  codec_dcs = codec_dcs_pin;
+  sampled_at = esp_timer_get_time();
+  return true;
+}
+
+void spiBusAcquire(spi_device device){
+  if(bus_mutex == NULL){
+    return;
+  }
+  int64_t asked = esp_timer_get_time();
+  bool contended = xSemaphoreTakeRecursive(bus_mutex, 0) != pdTRUE;
+  if(contended){
+    xSemaphoreTakeRecursive(bus_mutex, portMAX_DELAY);
+  }
+  if(depth++ > 0){
+    return; // e.g. an SD open inside a longer batch; accounted to the outer claim
+  }
+  int64_t now = esp_timer_get_time();
+  spi_device_usage &u = usage[device];
+  u.claims++;
+  if(contended){
+    u.waits++;
+    u.wait_us += now - asked;
+    u.longest_wait_us = max(u.longest_wait_us, now - asked);
+    peak_wait_us[device] = max(peak_wait_us[device], now - asked);
+  }
+  holder = device;
+  held_since = now;
+}
+
+void spiBusRelease(spi_device device){
+  if(bus_mutex == NULL){
+    return;
+  }
+  if(--depth == 0){
+    usage[holder].busy_us += esp_timer_get_time() - held_since;
+  }
+  xSemaphoreGiveRecursive(bus_mutex);
+}
+
+void spiBusBeginTransfer(spi_device device){
+  if(device != SPI_DEVICE_CODEC_DATA || codec_dcs < 0){
+    return;
+  }
+  SPI.beginTransaction(codec_data_settings);
+  digitalWrite(codec_dcs, LOW);
+}
+
+void spiBusWrite(const uint8_t *data, size_t len){
+  SPI.writeBytes(data, len);
+}
+
+void spiBusEndTransfer(spi_device device){
+  if(device != SPI_DEVICE_CODEC_DATA || codec_dcs < 0){
+    return;
+  }
+  digitalWrite(codec_dcs, HIGH);
+  SPI.endTransaction();
+}
+
+spi_device_usage spiBusUsage(spi_device device){
+  spi_device_usage u;
+  if(bus_mutex == NULL){
+    return u;
+  }
+  // the totals are only consistent while no claim is being accounted
+  xSemaphoreTakeRecursive(bus_mutex, portMAX_DELAY);
+  u = usage[device];
+  xSemaphoreGiveRecursive(bus_mutex);
+  return u;
+}
+
+void spiBusSample(spi_bus_sample &sample){
+  sample = spi_bus_sample();
+  if(bus_mutex == NULL){
+    return;
+  }
+  xSemaphoreTakeRecursive(bus_mutex, portMAX_DELAY);
+  int64_t now = esp_timer_get_time();
+  int64_t interval_us = max(now - sampled_at, (int64_t)1);
+  sample.interval_ms = interval_us / 1000;
+  for(int i = 0; i < SPI_DEVICE_COUNT; i++){
+    sample.busy_pct[i] = 100.0f * (usage[i].busy_us - sampled[i].busy_us) / interval_us;
+    sample.waits[i] = usage[i].waits - sampled[i].waits;
+    sample.longest_wait_ms[i] = peak_wait_us[i] / 1000;
+    sampled[i] = usage[i];
+    peak_wait_us[i] = 0;
+  }
+  sampled_at = now;
+  xSemaphoreGiveRecursive(bus_mutex);
+}
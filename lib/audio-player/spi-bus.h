@@ -0,0 +1,61 @@
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+/*
+  Schedules the SPI bus shared by the SD card (CARDCS), the VS1053 command port (VS1053_CS) and its data port (VS1053_DCS).
+
+  The ESP32 SPI driver only serialises single transactions, so left to themselves the drivers interleave at whatever grain
+  they choose: a 32 byte codec write between two sectors of a directory scan, each with its own chip select and clock
+  reconfiguration. Instead every user claims the bus for a whole batch of work with spiBusAcquire()/spiBusRelease(): a
+  multi-block SD read, a run of codec writes while DREQ is high, a register update. Waiting claims are granted highest task
+  priority first (it is a FreeRTOS mutex, with priority inheritance), so the audio task gets the bus between two batches of
+  a scan made from loop() rather than after all of it. Long jobs release the bus between batches.
+
+  Codec data is sent by this library rather than Adafruit_VS1053::playData(), which begins a transaction and toggles the
+  chip select for every 32 bytes: spiBusBeginTransfer() starts one transaction at the data port's own clock and keeps it
+  selected for as many chunks as the codec accepts. The SD card runs at SPI_BUS_SD_HZ (pass it to SD.begin()); the command
+  port stays at the Adafruit library's clock, as it only carries the occasional register write.
+
+  The time each device holds the bus, and the time claims spend waiting for it, is accumulated so that utilisation can be
+  published with spiBusSample().
+*/
+
+#define SPI_BUS_SD_HZ 20000000          // SD cards are specified to 25MHz in SPI mode; the ESP32 divides 80MHz down to 20MHz
+#define SPI_BUS_CODEC_DATA_HZ 9000000   // VS1053 SDI limit is CLKI/4, 9.2MHz once begin() has set SC_MULT 3.0x; the ESP32 rounds down to 8.9MHz
+
+// *********************************************************************************************************************
+// *** Data Types ***
+enum spi_device { SPI_DEVICE_SD, SPI_DEVICE_CODEC_CMD, SPI_DEVICE_CODEC_DATA, SPI_DEVICE_COUNT };
+
+struct spi_device_usage{
+  uint32_t claims = 0;            // outermost spiBusAcquire() calls; nested claims are part of the outer one
+  uint32_t waits = 0;             // claims that found the bus held by another task
+  int64_t busy_us = 0;            // total time the bus was held
+  int64_t wait_us = 0;            // total time claims waited
+  int64_t longest_wait_us = 0;
+};
+
+struct spi_bus_sample{
+  uint32_t interval_ms = 0;                       // since the previous sample
+  float busy_pct[SPI_DEVICE_COUNT] = {};          // share of the interval each device held the bus
+  uint32_t waits[SPI_DEVICE_COUNT] = {};
+  uint32_t longest_wait_ms[SPI_DEVICE_COUNT] = {};  // in the interval
+};
+
+// Provided in library
+bool initSpiBus(int8_t codec_dcs_pin);            // before any other task uses the bus; after musicPlayer.begin()
+void spiBusAcquire(spi_device device);            // claim the bus for a batch of work; may nest
+void spiBusRelease(spi_device device);
+void spiBusBeginTransfer(spi_device device);      // start a transaction and select device; only SPI_DEVICE_CODEC_DATA, between acquire and release
+void spiBusWrite(const uint8_t *data, size_t len);
+void spiBusEndTransfer(spi_device device);
+spi_device_usage spiBusUsage(spi_device device);  // totals since boot
+void spiBusSample(spi_bus_sample &sample);        // usage since the previous call; for a single caller (diagnostics)
+
+#endif
@@ -0,0 +1,75 @@
+#include "display-frame-cache.h"
+
+struct cached_frame{
+  uint32_t hash;
+  size_t len;                     // of the payload
+  uint32_t last_used;             // clock at the last hit or store; for LRU replacement
+  bool used;
+};
+
+static cached_frame *entries = NULL;
+static uint8_t *frames = NULL;    // frame_count frames of frame_size bytes
+static size_t frame_count = 0;
+static size_t frame_size = 0;
+static uint32_t clock_now = 0;  // counts hits and stores
+static display_frame_cache_stats stats;
+
+bool initDisplayFrameCache(size_t count, size_t frame_bytes){
+  if(!psramFound()){
+    Sprintln(F("No PSRAM; display frame cache disabled"));
+    return false;
+  }
+  entries = (cached_frame *)calloc(count, sizeof(cached_frame));
+  frames = (uint8_t *)ps_malloc(count * frame_bytes);
+  if(entries == NULL || frames == NULL){
+    free(entries);
+    free(frames);
+    entries = NULL;
+    frames = NULL;
+    return false;
+  }
+  frame_count = count;
+  frame_size = frame_bytes;
+  return true;
+}
+
+bool displayFrameCacheLoad(uint32_t hash, size_t len, uint8_t *frame){
+  for(size_t i = 0; i < frame_count; i++){
+    if(entries[i].used && entries[i].hash == hash && entries[i].len == len){
+      memcpy(frame, frames + i * frame_size, frame_size);
+      entries[i].last_used = ++clock_now;
+      stats.hits++;
+      return true;
+    }
+  }
+  stats.misses++;
+  return false;
+}
+
+void displayFrameCacheStore(uint32_t hash, size_t len, const uint8_t *frame){
+  if(frame_count == 0){
+    return;
+  }
+  size_t slot = 0;
+  for(size_t i = 0; i < frame_count; i++){
+    if(!entries[i].used){
+      slot = i;
+      break;
+    }
+    if(entries[i].last_used < entries[slot].last_used){
+      slot = i;
+    }
+  }
+  memcpy(frames + slot * frame_size, frame, frame_size);
+  entries[slot] = { hash, len, ++clock_now, true };
+}
+
+void displayFrameCacheClear(){
+  for(size_t i = 0; i < frame_count; i++){
+    entries[i].used = false;
+  }
+}
+
+const display_frame_cache_stats &displayFrameCacheStats(){
+  return stats;
+}
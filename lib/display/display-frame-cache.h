@@ -0,0 +1,34 @@
+#ifndef DISPLAY_FRAME_CACHE_H
+#define DISPLAY_FRAME_CACHE_H
+
+#include <Arduino.h>
+#include "rom/crc.h"
+#include "log.h"
+
+/*
+  Recently rendered display frames in PSRAM, keyed by the display command that produced them.
+
+  mqtt2chime cycles through a few carousel slots and repeats the current one on every sensor message. A command that
+  is already on screen is skipped before this cache is asked (see processMessages()); one shown a few slots ago is
+  found here and copied into the frame buffer whole (8KB, a few tens of microseconds) instead of being parsed and drawn
+  again. The key is the CRC32 of the command's payload and its length. When every slot is taken the least recently
+  used frame is replaced.
+
+  Called from one task only, normally loop().
+*/
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct display_frame_cache_stats{
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+};
+
+// Provided in library
+bool initDisplayFrameCache(size_t frames, size_t frame_bytes);                  // PSRAM; false if there is none
+bool displayFrameCacheLoad(uint32_t hash, size_t len, uint8_t *frame);          // copy a cached frame out; false on a miss
+void displayFrameCacheStore(uint32_t hash, size_t len, const uint8_t *frame);   // replaces the least recently used
+void displayFrameCacheClear();                                                  // e.g. a graphic was replaced
+const display_frame_cache_stats &displayFrameCacheStats();
+
+#endif
@@ -0,0 +1,690 @@
+#include "display-panel.h"
+
+DisplayPanel::DisplayPanel(uint16_t w, uint16_t h, TwoWire *twi, int8_t rst_pin, uint32_t preclk, uint32_t postclk)
+  : Adafruit_SSD1327(w, h, twi, rst_pin, preclk, postclk){
+}
+
+DisplayPanel::~DisplayPanel(){
+  stopScroll();
+  free(shadow);
+  free(front);
+  free(slice);
+}
+
+bool DisplayPanel::begin(uint8_t i2caddr, bool reset){
+  if(!Adafruit_SSD1327::begin(i2caddr, reset)){
+    return false;
+  }
+  if(shadow == NULL){
+    shadow = (uint8_t *)malloc((size_t)HEIGHT * WIDTH / 2);
+    if(shadow == NULL){
+      Sprintln(F("Display: no memory for the shadow frame; sending whole frames"));
+    }
+  }
+  shadow_valid = false;
+  stats = display_flush_stats();
+  return true;
+}
+
+bool DisplayPanel::startFlushTask(){
+  if(flush_task != NULL){
+    return true;
+  }
+  if(shadow == NULL || i2c_dev == NULL){
+    return false; // sending from the caller's task
+  }
+  const size_t row_bytes = WIDTH / 2;
+  front = (uint8_t *)malloc((size_t)HEIGHT * row_bytes);
+  slice = (uint8_t *)malloc(DISPLAY_FLUSH_SLICE_ROWS * row_bytes);
+  frame_lock = xSemaphoreCreateMutex();
+  if(front == NULL || slice == NULL || frame_lock == NULL){
+    Sprintln(F("Display: no memory for the flush task"));
+    return false;
+  }
+  memcpy(front, buffer, (size_t)HEIGHT * row_bytes);
+  esp_timer_create_args_t timer = {};
+  timer.callback = scrollTimer;
+  timer.arg = this;
+  timer.name = "display scroll";
+  if(esp_timer_create(&timer, &scroll_timer) != ESP_OK){
+    scroll_timer = NULL; // no scrolling
+  }
+  return xTaskCreate(flushTask, "display", DISPLAY_FLUSH_TASK_STACK, this, DISPLAY_FLUSH_TASK_PRIORITY, &flush_task) == pdPASS;
+}
+
+void DisplayPanel::invalidate(){
+  lockFrame();
+  shadow_valid = false;
+  unlockFrame();
+}
+
+display_flush_stats DisplayPanel::lastFlush(){
+  lockFrame();
+  display_flush_stats copy = stats;
+  unlockFrame();
+  return copy;
+}
+
+void DisplayPanel::lockFrame(){
+  if(frame_lock != NULL){
+    xSemaphoreTake(frame_lock, portMAX_DELAY);
+  }
+}
+
+void DisplayPanel::unlockFrame(){
+  if(frame_lock != NULL){
+    xSemaphoreGive(frame_lock);
+  }
+}
+
+/*
+  The first window of rows that differ from the shadow, at or after from_row, of at most max_rows rows.
+  Changed rows are added to the window while that costs fewer bytes than a window of their own (see the header).
+*/
+bool DisplayPanel::nextWindow(const uint8_t *frame, int16_t from_row, int16_t max_rows, display_window &win){
+  const int16_t row_bytes = WIDTH / 2;
+  bool found = false;
+
+  for(int16_t row = from_row; row < HEIGHT; row++){
+    const uint8_t *now = frame + row * row_bytes;
+    const uint8_t *was = shadow + row * row_bytes;
+
+    int16_t lo = 0;
+    while(lo < row_bytes && now[lo] == was[lo]){
+      lo++;
+    }
+    if(lo == row_bytes){
+      continue; // unchanged
+    }
+    int16_t hi = row_bytes - 1;
+    while(now[hi] == was[hi]){
+      hi--;
+    }
+
+    if(!found){
+      win = { row, row, lo, hi };
+      found = true;
+      continue;
+    }
+    if(row - win.first_row + 1 > max_rows){
+      break;
+    }
+    // extend the window down to this row (sending the clean rows between), or leave the row for the next window
+    int16_t merged_lo = min(win.first_col, lo);
+    int16_t merged_hi = max(win.last_col, hi);
+    int32_t merged = (int32_t)(row - win.first_row + 1) * (merged_hi - merged_lo + 1);
+    int32_t apart = (int32_t)(win.last_row - win.first_row + 1) * (win.last_col - win.first_col + 1) + (hi - lo + 1) + DISPLAY_PANEL_WINDOW_COST;
+    if(merged > apart){
+      break;
+    }
+    win.last_row = row;
+    win.first_col = merged_lo;
+    win.last_col = merged_hi;
+  }
+  return found;
+}
+
+/*
+  rows holds the window's rows, whole (WIDTH / 2 bytes each), from its first row.
+  Over I2C the window is sent from there, as the flush task sends from its own copy of the rows. Over SPI (only from
+  the caller's task, so rows are in the frame buffer) the base class sends its dirty window.
+*/
+void DisplayPanel::sendWindow(const display_window &win, const uint8_t *rows){
+  const int16_t row_bytes = WIDTH / 2;
+  const int16_t cols = win.last_col - win.first_col + 1;
+
+  if(i2c_dev != NULL){
+    uint8_t cmd[] = { SSD1327_SETROW, (uint8_t)win.first_row, (uint8_t)win.last_row,
+                      SSD1327_SETCOLUMN, (uint8_t)win.first_col, (uint8_t)win.last_col };
+    uint8_t dc_byte = 0x40; // data follows
+    size_t max_len = i2c_dev->maxBufferSize() - 1;
+
+    i2c_dev->setSpeed(i2c_preclk);
+    oled_commandList(cmd, sizeof(cmd));
+    for(int16_t row = 0; row <= win.last_row - win.first_row; row++){
+      const uint8_t *p = rows + row * row_bytes + win.first_col;
+      for(int16_t left = cols; left > 0; ){
+        size_t len = min((size_t)left, max_len);
+        i2c_dev->write(p, len, true, &dc_byte, 1);
+        p += len;
+        left -= len;
+      }
+    }
+    i2c_dev->setSpeed(i2c_postclk);
+  }
+  else{
+    window_x1 = win.first_col * 2;
+    window_x2 = win.last_col * 2 + 1;
+    window_y1 = win.first_row;
+    window_y2 = win.last_row;
+    Adafruit_SSD1327::display();
+  }
+}
+
+/*
+  Send windows until the panel matches frame. With the flush task, frame is the front buffer, which display() may
+  replace between two slices: each slice's rows are copied out under the lock and sent from the copy, and the scan
+  goes on from the slice's last row in whichever frame is there by then. Rows above it that the new frame changed are
+  sent on the next pass, as display() has woken the task again.
+*/
+void DisplayPanel::flush(const uint8_t *frame, int16_t max_rows, bool log){
+  const int16_t row_bytes = WIDTH / 2;
+  int64_t start = esp_timer_get_time();
+  display_flush_stats pass;
+
+  for(int16_t row = 0; ; ){
+    display_window win;
+
+    lockFrame();
+    if(!shadow_valid){ // panel contents unknown: make every byte differ
+      for(size_t i = 0; i < (size_t)HEIGHT * row_bytes; i++){
+        shadow[i] = ~frame[i];
+      }
+      shadow_valid = true;
+      row = 0;
+    }
+    bool found = nextWindow(frame, row, max_rows, win);
+    const uint8_t *rows = frame + win.first_row * row_bytes;
+    if(found && slice != NULL){
+      memcpy(slice, rows, (size_t)(win.last_row - win.first_row + 1) * row_bytes);
+      rows = slice;
+    }
+    unlockFrame();
+    if(!found){
+      break;
+    }
+
+    sendWindow(win, rows);
+    for(int16_t r = win.first_row; r <= win.last_row; r++){
+      memcpy(shadow + r * row_bytes + win.first_col, rows + (r - win.first_row) * row_bytes + win.first_col, win.last_col - win.first_col + 1);
+    }
+    uint16_t win_rows = win.last_row - win.first_row + 1;
+    pass.bytes += 6 + (uint32_t)win_rows * (win.last_col - win.first_col + 1); // SETROW and SETCOLUMN with their start and end
+    pass.windows++;
+    pass.rows += win_rows;
+
+    row = win.last_row + 1;
+    if(slice != NULL){
+      taskYIELD();
+    }
+  }
+
+  pass.us = (uint32_t)(esp_timer_get_time() - start);
+  lockFrame();
+  pass.flushes = stats.flushes + 1;
+  pass.total_bytes = stats.total_bytes + pass.bytes;
+  stats = pass;
+  unlockFrame();
+
+  if(log){
+    Sprint(F("Display flush: ")); Sprint(pass.bytes); Sprint(F(" bytes in ")); Sprint(pass.windows); Sprint(F(" windows, "));
+    Sprint(pass.us); Sprintln(F("us"));
+  }
+}
+
+void DisplayPanel::flushTask(void *panel){
+  DisplayPanel *self = (DisplayPanel *)panel;
+  for(;;){
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->lockFrame();
+    bool posted = self->frame_posted;
+    self->frame_posted = false;
+    bool scrolled = self->stepScroll(posted); // a new frame has the scrolling band as drawn, not as it has moved to
+    self->unlockFrame();
+    if(posted || scrolled){
+      self->flush(self->front, DISPLAY_FLUSH_SLICE_ROWS, posted); // steps of scrolling text are not logged
+    }
+  }
+}
+
+void DisplayPanel::display(){
+  if(shadow == NULL){ // nothing to compare with; the whole frame
+    window_x1 = 0;
+    window_x2 = WIDTH - 1;
+    window_y1 = 0;
+    window_y2 = HEIGHT - 1;
+    Adafruit_SSD1327::display();
+    return;
+  }
+  if(flush_task == NULL){
+    flush(buffer, HEIGHT, true);
+    return;
+  }
+
+  lockFrame();
+  memcpy(front, buffer, (size_t)HEIGHT * WIDTH / 2);
+  frame_posted = true;
+  unlockFrame();
+  xTaskNotifyGive(flush_task);
+}
+
+// len pixels of a frame buffer row from x, clipped to its width; two pixels a byte, the even one in the high nibble
+static inline void fillRow(uint8_t *row, int16_t width, int16_t x, int16_t len, uint8_t grey){
+  if(x < 0){
+    len += x;
+    x = 0;
+  }
+  if(x + len > width){
+    len = width - x;
+  }
+  if(len <= 0){
+    return;
+  }
+  uint8_t *p = row + x / 2;
+  if(x & 1){
+    *p = (*p & 0xf0) | grey;
+    p++;
+    len--;
+  }
+  memset(p, grey << 4 | grey, len / 2);
+  if(len & 1){
+    p[len / 2] = (p[len / 2] & 0x0f) | grey << 4;
+  }
+}
+
+void DisplayPanel::fillSpan(int16_t x, int16_t y, int16_t len, uint16_t color){
+  if(getRotation() != 0){
+    drawFastHLine(x, y, len, color);
+    return;
+  }
+  if(y < 0 || y >= HEIGHT){
+    return;
+  }
+  fillRow(buffer + y * (WIDTH / 2), WIDTH, x, len, color & 0x0f);
+}
+
+/*
+  len pixels from pixel src_x of src to pixel dst_x of dst, both rows of the frame buffer's layout.
+*/
+void DisplayPanel::copyGreyRow(uint8_t *dst, int16_t dst_x, const uint8_t *src, int16_t src_x, int16_t len){
+  if(dst_x & 1){ // into the low nibble of the first byte
+    uint8_t grey = (src_x & 1) ? src[src_x / 2] & 0x0f : src[src_x / 2] >> 4;
+    dst[dst_x / 2] = (dst[dst_x / 2] & 0xf0) | grey;
+    dst_x++;
+    src_x++;
+    len--;
+  }
+  dst += dst_x / 2;
+  src += src_x / 2;
+  if(!(src_x & 1)){ // same alignment: whole bytes
+    memcpy(dst, src, len / 2);
+  }
+  else{
+    for(int16_t i = 0; i < len / 2; i++){
+      dst[i] = src[i] << 4 | src[i + 1] >> 4;
+    }
+  }
+  if(len & 1){ // into the high nibble of the last byte
+    uint8_t grey = (src_x & 1) ? src[len / 2] << 4 : src[len / 2] & 0xf0;
+    dst[len / 2] = grey | (dst[len / 2] & 0x0f);
+  }
+}
+
+void DisplayPanel::drawGreyBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h){
+  const int16_t src_bytes = (w + 1) / 2;
+
+  if(getRotation() != 0){
+    for(int16_t j = 0; j < h; j++){
+      for(int16_t i = 0; i < w; i++){
+        uint8_t pair = bitmap[j * src_bytes + i / 2];
+        drawPixel(x + i, y + j, (i & 1) ? pair & 0x0f : pair >> 4);
+      }
+    }
+    return;
+  }
+  int16_t first = max(0, -x);                 // columns of the bitmap on screen
+  int16_t last = min((int)w, WIDTH - x);
+  if(first >= last){
+    return;
+  }
+  for(int16_t j = max(0, -y); j < h && y + j < HEIGHT; j++){
+    copyGreyRow(buffer + (y + j) * (WIDTH / 2), x + first, bitmap + j * src_bytes, first, last - first);
+  }
+}
+
+// nibbles lit by four pixels of a 1 bit bitmap (the leftmost in the most significant bit), the leftmost in the high nibble
+static const uint16_t NIBBLE_MASK[16] = {
+  0x0000, 0x000f, 0x00f0, 0x00ff, 0x0f00, 0x0f0f, 0x0ff0, 0x0fff,
+  0xf000, 0xf00f, 0xf0f0, 0xf0ff, 0xff00, 0xff0f, 0xfff0, 0xffff
+};
+
+void DisplayPanel::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color){
+  if(getRotation() != 0){
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  const int16_t src_bytes = (w + 7) / 8;
+  const uint8_t shift = (x & 1) * 4;          // an odd x puts the first pixel in a low nibble
+  const uint8_t grey = (color & 0x0f) * 0x11;
+
+  for(int16_t j = max(0, -y); j < h && y + j < HEIGHT; j++){
+    uint8_t *row = buffer + (y + j) * (WIDTH / 2);
+    for(int16_t i = 0; i < src_bytes; i++){
+      uint8_t bits = bitmap[j * src_bytes + i];
+      if(i == src_bytes - 1 && (w & 7)){
+        bits &= 0xff00 >> (w & 7);            // padding
+      }
+      if(bits == 0){
+        continue;
+      }
+      // the eight pixels' nibbles across five bytes, the first in bits 39..32
+      uint64_t mask = ((uint64_t)NIBBLE_MASK[bits >> 4] << 24 | (uint64_t)NIBBLE_MASK[bits & 0x0f] << 8) >> shift;
+      int16_t col = ((x + i * 8) >> 1);       // byte of the first pixel; rounds down for negative x
+      for(int16_t k = 0; k < 5; k++, col++){
+        uint8_t m = mask >> (32 - 8 * k);
+        if(m != 0 && col >= 0 && col < WIDTH / 2){
+          row[col] = (row[col] & ~m) | (grey & m);
+        }
+      }
+    }
+  }
+}
+
+const uint8_t *DisplayPanel::drawRleRow(int16_t x, int16_t y, const uint8_t *runs, int16_t w, uint16_t color){
+  bool lit = false;
+  for(int16_t col = 0; col < w; lit = !lit){
+    uint8_t run = *runs++; // PROGMEM is addressable flash on the ESP32
+    if(lit && run > 0){
+      fillSpan(x + col, y, run, color);
+    }
+    col += run;
+  }
+  return runs;
+}
+
+void DisplayPanel::drawRleBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color){
+  const uint8_t *code = bitmap;
+  const uint8_t *row = bitmap;  // runs of the last row drawn, for repeats
+
+  for(int16_t line = 0; line < h; ){
+    if(*code & DISPLAY_RLE_REPEAT){
+      for(int16_t n = (*code & ~DISPLAY_RLE_REPEAT) + 1; n > 0 && line < h; n--){
+        drawRleRow(x, y + line++, row, w, color);
+      }
+      code++;
+    }
+    else{
+      row = code;
+      code = drawRleRow(x, y + line++, code, w, color);
+    }
+  }
+}
+
+void DisplayPanel::setGlyphs(const display_glyphs *atlas, uint8_t sizes){
+  glyph_atlas = atlas;
+  glyph_sizes = sizes;
+}
+
+// atlas of text size, NULL if there is none or the screen is rotated
+const display_glyphs *DisplayPanel::glyphsFor(uint8_t size){
+  for(uint8_t i = 0; i < glyph_sizes && getRotation() == 0; i++){
+    if(glyph_atlas[i].size == size){
+      return &glyph_atlas[i];
+    }
+  }
+  return NULL;
+}
+
+/*
+  Break text into lines of at most cols characters, and at newlines. With words, a line ends after its last whole word
+  (a word longer than a line is broken anyway) and the space it ended at is dropped; without, it is cut at cols, as
+  Adafruit_GFX wraps. Lines past max_lines are counted but not kept.
+*/
+uint8_t DisplayPanel::layoutText(const char *text, int16_t cols, bool words, display_text_line *lines, uint8_t max_lines){
+  uint8_t count = 0;
+  const char *p = text;
+
+  while(*p != '\0' && count < 255){
+    int16_t len = 0;
+    while(len < cols && p[len] != '\0' && p[len] != '\n'){
+      len++;
+    }
+    int16_t next = len;
+    if(p[len] == '\n'){
+      next++;
+    }
+    else if(words && p[len] == ' '){
+      next++;
+    }
+    else if(words && p[len] != '\0'){ // in the middle of a word
+      int16_t space = len;
+      while(space > 0 && p[space - 1] != ' '){
+        space--;
+      }
+      if(space > 0){
+        len = space - 1;
+        next = space;
+      }
+    }
+    if(count < max_lines){
+      lines[count] = { p, (uint8_t)len };
+    }
+    count++;
+    p += next;
+  }
+  return count;
+}
+
+// coverage of grey over the pixel at x of a frame buffer row
+static inline void blendPixel(uint8_t *row, int16_t width, int16_t x, uint8_t grey, uint8_t coverage){
+  if(x < 0 || x >= width){
+    return;
+  }
+  uint8_t &pair = row[x / 2];
+  uint8_t was = (x & 1) ? pair & 0x0f : pair >> 4;
+  uint8_t now = (was * (15 - coverage) + grey * coverage + 7) / 15;
+  pair = (x & 1) ? (pair & 0xf0) | now : (pair & 0x0f) | now << 4;
+}
+
+// c at x, y of a frame of frame_w (even) x frame_h pixels in the frame buffer's layout, clipped to it
+static void drawGlyph(uint8_t *frame, int16_t frame_w, int16_t frame_h, int16_t x, int16_t y, const display_glyphs *glyphs,
+                      uint8_t c, uint8_t color, uint8_t bg, bool opaque){
+  const int16_t w = 6 * glyphs->size;
+  const int16_t h = 8 * glyphs->size;
+  const uint8_t *run = glyphs->runs + glyphs->offsets[c - glyphs->first]; // PROGMEM is addressable flash on the ESP32
+
+  for(int16_t j = 0; j < h && y + j < frame_h; j++){
+    uint8_t *row = frame + (y + j) * (frame_w / 2);
+    for(int16_t i = 0; i < w; run++){
+      uint8_t len = (*run >> 4) + 1;
+      uint8_t coverage = *run & 0x0f;
+      if(y + j < 0){
+        // above the screen; only counting the row's runs
+      }
+      else if(opaque){
+        fillRow(row, frame_w, x + i, len, (bg * (15 - coverage) + color * coverage + 7) / 15);
+      }
+      else if(coverage == 15){
+        fillRow(row, frame_w, x + i, len, color);
+      }
+      else if(coverage != 0){
+        for(int16_t k = 0; k < len; k++){
+          blendPixel(row, frame_w, x + i + k, color, coverage);
+        }
+      }
+      i += len;
+    }
+  }
+}
+
+void DisplayPanel::drawText(int16_t x, int16_t y, const char *text, uint8_t size, uint16_t color, uint16_t bg){
+  if(text == NULL || size == 0){
+    return;
+  }
+  const int16_t cell_w = 6 * size;
+  const int16_t cell_h = 8 * size;
+  const int16_t cols = max(1, (width() - x) / cell_w);
+  const int16_t rows = max(1, (height() - y) / cell_h);
+
+  display_text_line lines[DISPLAY_TEXT_MAX_LINES];
+  uint8_t count = layoutText(text, cols, true, lines, DISPLAY_TEXT_MAX_LINES);
+  if(count > rows){ // whole words do not fit; fill every line instead
+    count = layoutText(text, cols, false, lines, DISPLAY_TEXT_MAX_LINES);
+  }
+
+  const display_glyphs *glyphs = glyphsFor(size);
+  for(uint8_t l = 0; l < min(count, (uint8_t)DISPLAY_TEXT_MAX_LINES) && y + l * cell_h < height(); l++){
+    for(uint8_t k = 0; k < lines[l].len; k++){
+      uint8_t c = lines[l].text[k];
+      int16_t cx = x + k * cell_w;
+      int16_t cy = y + l * cell_h;
+      if(glyphs != NULL && c >= glyphs->first && c - glyphs->first < glyphs->count){
+        drawGlyph(buffer, WIDTH, HEIGHT, cx, cy, glyphs, c, color & 0x0f, bg & 0x0f, bg != color);
+      }
+      else{
+        drawChar(cx, cy, c, color, bg, size);
+      }
+    }
+  }
+}
+
+bool DisplayPanel::textFits(int16_t y, const char *text, uint8_t size){
+  if(text == NULL || size == 0){
+    return true;
+  }
+  display_text_line lines[DISPLAY_TEXT_MAX_LINES];
+  int16_t rows = max(1, (height() - y) / (8 * size));
+  return layoutText(text, max(1, width() / (6 * size)), false, lines, DISPLAY_TEXT_MAX_LINES) <= rows;
+}
+
+void DisplayPanel::clearDisplay(){
+  stopScroll();
+  Adafruit_SSD1327::clearDisplay();
+}
+
+/*
+  Draw text into a strip of its own, once: for pages, lines as drawText() breaks them between words, as many pages of the
+  rows below y as they take; for a marquee, one line (newlines as spaces) with DISPLAY_SCROLL_GAP after it. The first
+  view of it is drawn into the frame buffer now, as drawText() would have, and the flush task moves it on from there.
+*/
+bool DisplayPanel::scrollText(int16_t y, const char *text, uint8_t size, uint16_t color, display_scroll_mode mode){
+  stopScroll();
+  const display_glyphs *glyphs = glyphsFor(size);
+  if(text == NULL || size == 0 || glyphs == NULL || flush_task == NULL || scroll_timer == NULL || y < 0){
+    return false;
+  }
+  const int16_t cell_w = 6 * size;
+  const int16_t cell_h = 8 * size;
+  const int16_t rows = (HEIGHT - y) / cell_h;
+  if(rows == 0){
+    return false;
+  }
+
+  display_scroll s;
+  s.mode = mode;
+  s.y = y;
+  s.pos = 0;
+  s.step = DISPLAY_SCROLL_STEP * size;
+  s.hold = DISPLAY_SCROLL_PAUSE_MS / DISPLAY_SCROLL_STEP_MS;
+
+  static display_text_line lines[DISPLAY_SCROLL_MAX_LINES]; // only from loop()
+  uint8_t count;
+  if(mode == DISPLAY_SCROLL_PAGES){
+    count = min(layoutText(text, WIDTH / cell_w, true, lines, DISPLAY_SCROLL_MAX_LINES), (uint8_t)DISPLAY_SCROLL_MAX_LINES);
+    s.h = rows * cell_h;
+    s.strip_w = WIDTH;
+    s.strip_h = (count + rows - 1) / rows * s.h;
+    s.stop = s.h;
+  }
+  else{
+    size_t len = min(strlen(text), (size_t)(INT16_MAX - DISPLAY_SCROLL_GAP) / cell_w);
+    lines[0] = { text, (uint8_t)min(len, (size_t)UINT8_MAX) };
+    count = 1;
+    s.h = cell_h;
+    s.strip_w = (lines[0].len * cell_w + DISPLAY_SCROLL_GAP + s.step - 1) / s.step * s.step; // even, as step is
+    s.strip_h = cell_h;
+    s.stop = s.strip_w;
+  }
+  if(count == 0){
+    return false;
+  }
+
+  size_t strip_size = (size_t)s.strip_w / 2 * s.strip_h;
+  s.strip = (uint8_t *)(psramFound() ? ps_malloc(strip_size) : malloc(strip_size));
+  if(s.strip == NULL){
+    Sprintln(F("Display: no memory to scroll text"));
+    return false;
+  }
+  memset(s.strip, 0, strip_size);
+  for(uint8_t l = 0; l < count; l++){
+    for(uint8_t k = 0; k < lines[l].len; k++){
+      uint8_t c = lines[l].text[k] == '\n' ? ' ' : lines[l].text[k];
+      if(c >= glyphs->first && c - glyphs->first < glyphs->count){
+        drawGlyph(s.strip, s.strip_w, s.strip_h, k * cell_w, l * cell_h, glyphs, c, color & 0x0f, 0, false);
+      }
+    }
+  }
+
+  lockFrame();
+  scroll = s;
+  scroll_due = false;
+  unlockFrame();
+  drawScroll(buffer);
+  esp_timer_start_periodic(scroll_timer, DISPLAY_SCROLL_STEP_MS * 1000);
+  return true;
+}
+
+void DisplayPanel::stopScroll(){
+  if(scroll_timer != NULL){
+    esp_timer_stop(scroll_timer);
+  }
+  lockFrame();
+  uint8_t *strip = scroll.strip;
+  scroll.strip = NULL;
+  unlockFrame();
+  free(strip);
+}
+
+// The band's view of the strip into frame (the frame buffer, or the front buffer under the lock)
+void DisplayPanel::drawScroll(uint8_t *frame){
+  const display_scroll &s = scroll;
+  const int16_t row_bytes = WIDTH / 2;
+  for(int16_t j = 0; j < s.h && s.y + j < HEIGHT; j++){
+    uint8_t *row = frame + (s.y + j) * row_bytes;
+    if(s.mode == DISPLAY_SCROLL_PAGES){ // rows wrap round to the first page
+      memcpy(row, s.strip + (size_t)((s.pos + j) % s.strip_h) * row_bytes, row_bytes);
+    }
+    else{ // columns wrap round to the start
+      const uint8_t *strip_row = s.strip + (size_t)j * (s.strip_w / 2);
+      int16_t first = min((int16_t)WIDTH, (int16_t)(s.strip_w - s.pos));
+      copyGreyRow(row, 0, strip_row, s.pos, first);
+      for(int16_t x = first; x < WIDTH; x += s.strip_w){
+        copyGreyRow(row, x, strip_row, 0, min((int16_t)(WIDTH - x), s.strip_w));
+      }
+    }
+  }
+}
+
+/*
+  From the flush task, under the lock: if a step is due, move the text on (or count down a pause) and draw it into the
+  front buffer. redraw draws it where it is regardless. True if the front buffer changed.
+*/
+bool DisplayPanel::stepScroll(bool redraw){
+  if(scroll.strip == NULL){
+    return false;
+  }
+  if(scroll_due){
+    scroll_due = false;
+    if(scroll.hold > 0){
+      scroll.hold--;
+    }
+    else{
+      scroll.pos = (scroll.pos + scroll.step) % (scroll.mode == DISPLAY_SCROLL_PAGES ? scroll.strip_h : scroll.strip_w);
+      if(scroll.pos % scroll.stop == 0){
+        scroll.hold = DISPLAY_SCROLL_PAUSE_MS / DISPLAY_SCROLL_STEP_MS;
+      }
+      redraw = true;
+    }
+  }
+  if(redraw){
+    drawScroll(front);
+  }
+  return redraw;
+}
+
+// esp_timer task: no more than wake the flush task
+void DisplayPanel::scrollTimer(void *panel){
+  DisplayPanel *self = (DisplayPanel *)panel;
+  self->scroll_due = true;
+  xTaskNotifyGive(self->flush_task);
+}
@@ -0,0 +1,180 @@
+#ifndef DISPLAY_PANEL_H
+#define DISPLAY_PANEL_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1327.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "log.h"
+
+/*
+  SSD1327 (128x128, 4 bits per pixel) that only sends the parts of the frame that changed.
+
+  Adafruit_GrayOLED keeps a dirty window, but clearDisplay() widens it to the whole screen and every drawPixel() widens it
+  whether or not the pixel changed, so a screen that is cleared and redrawn (as every message is) costs a full 8KB frame:
+  74ms of I2C at 1MHz, to change one line of text. DisplayPanel keeps a shadow copy of what the panel's GDDRAM holds and,
+  on display(), compares the frame buffer with it a row at a time. Runs of changed rows are grouped into windows, each the
+  changed columns of its rows, and only those are sent, each preceded by its row and column address commands. A clean
+  row between two changed ones is sent rather than starting a new window when that is cheaper than the window's
+  commands; DISPLAY_PANEL_WINDOW_COST is the break even.
+
+  Columns are addressed in bytes (two pixels), which is also the buffer's layout, so a window is exactly the bytes that
+  differ. Until the first display() after begin() the panel's contents are unknown and the whole frame is sent.
+
+  Flush task: by default display() sends from the caller's task and returns when the panel is up to date. Once
+  startFlushTask() has run (I2C only), the frame is double buffered: display() copies the frame being drawn (the back
+  buffer, Adafruit's 'buffer') into a front buffer under a lock held only for the copy, wakes the flush task and returns
+  at once, so loop() goes straight back to MQTT while the panel is updated. The task runs at loopTask's priority, below
+  the audio task, and sends a slice of at most DISPLAY_FLUSH_SLICE_ROWS rows at a time: it takes the lock only to find
+  the next window and copy its rows out of the front buffer, sends them, then yields. A frame posted part way through
+  supersedes the old one from the next slice on, and rows it shares with what the panel already holds are never sent.
+
+  The flush task and loop() (the BME280) share Wire: the ESP32 core locks each transaction, and the BME280 is rated
+  far above the 1MHz the panel's transfers leave the bus at.
+
+  The cost of every flush (bytes sent, windows, time) is kept in display_flush_stats; see lastFlush(). With the task,
+  a flush is everything sent between being woken and having nothing left to send.
+
+  Drawing: the bitmaps in graphics.h (see lib/display/make-bitmaps.py, which generates them from content/graphics) are
+  written straight into the frame buffer rather than a pixel at a time through drawPixel():
+  - 4 bit grey bitmaps are in the frame buffer's own layout, two pixels a byte, so drawGreyBitmap() copies them a row
+    at a time with memcpy(), clipped to the screen. They are opaque: black pixels are copied too. At an odd x the
+    nibbles are shifted into place a byte at a time instead.
+  - 1 bit bitmaps run length encoded by row are decoded by drawRleBitmap() a run of lit pixels at a time with
+    fillSpan(). Unlit pixels are left as they are, as with Adafruit's drawBitmap() without a background colour.
+  - plain 1 bit bitmaps (Adafruit's format) are drawn by drawBitmap() eight pixels at a time: a lookup table expands
+    each four bits to the nibbles they light, and those are masked into the frame buffer's bytes.
+  Each writes the buffer directly, so takes that path for rotation 0 only; otherwise it falls back to Adafruit_GFX.
+
+  Text: drawText() lays a whole string out before drawing any of it, in one pass over it: lines break between words
+  where the words fit in the rows left below y, otherwise anywhere (as Adafruit's print() does with wrapping on), so a
+  message that filled the screen before still does. Each character is then drawn from a glyph atlas (glyphs.h, generated
+  from Adafruit's own font by lib/display/make-glyphs.py; see setGlyphs()), a row of the cell at a time as runs of
+  equal coverage: full and empty runs with fillSpan(), the grey edges of anti-aliased sizes blended into what is there.
+  Characters or sizes the atlas does not have, and other rotations, are drawn with Adafruit's drawChar().
+
+  Scrolling text: text too long for the screen (textFits()) can be shown by scrollText() instead, in a band of rows
+  from y down: a page of lines at a time moving up (DISPLAY_SCROLL_PAGES), or as one line moving left
+  (DISPLAY_SCROLL_MARQUEE). The whole text is drawn once, into a strip off screen; each step copies the band's view of
+  the strip into the front buffer, so the diff in flush() sends the band's rows and nothing else. Steps are timed by an
+  esp_timer, whose callback only wakes the flush task: the step is taken there, at the task's priority below the audio
+  task's, and never from loop(). A step that is still being sent when the next is due delays it rather than queueing
+  it. The SSD1327's own scroll commands do not fit: horizontal scrolling wraps the panel's 128 columns round rather than
+  bringing in new ones, and moving the display's start line moves the whole screen, graphic and all.
+  Scrolling needs the flush task and the glyph atlas; clearDisplay() ends it.
+*/
+
+#define DISPLAY_PANEL_WINDOW_COST 16    // bytes; a window's address commands and I2C framing, as pixel data
+#define DISPLAY_FLUSH_SLICE_ROWS 16     // rows sent between two yields of the flush task; 1KB, about 9ms of I2C at 1MHz
+#define DISPLAY_FLUSH_TASK_PRIORITY 1   // as loopTask; below the audio task
+#define DISPLAY_FLUSH_TASK_STACK 3072   // bytes
+#define DISPLAY_RLE_REPEAT 0x80         // row code: the previous row again, (code & 0x7f) + 1 times; otherwise a run length
+#define DISPLAY_TEXT_MAX_LINES 16       // laid out by drawText(); a screen of size 1 text
+#define DISPLAY_SCROLL_MAX_LINES 64     // laid out by scrollText(); 255 characters at size 3
+#define DISPLAY_SCROLL_STEP_MS 40       // between two steps of scrolling text
+#define DISPLAY_SCROLL_STEP 2           // pixels moved a step, times the text size
+#define DISPLAY_SCROLL_PAUSE_MS 3000    // held at each page, and at the start of a marquee
+#define DISPLAY_SCROLL_GAP 48           // pixels between the end of a marquee and its start coming round again
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct display_flush_stats{
+  uint32_t bytes = 0;             // sent to the panel: address commands and pixel data
+  uint16_t windows = 0;           // separately addressed regions
+  uint16_t rows = 0;              // rows touched
+  uint32_t us = 0;                // compare and transfer (with the flush task, including yields between slices)
+  uint32_t flushes = 0;           // since begin(), including those with nothing to send
+  uint32_t total_bytes = 0;       // since begin()
+};
+
+struct display_window{
+  int16_t first_row, last_row;
+  int16_t first_col, last_col;    // bytes (two pixels)
+};
+
+struct display_glyphs{
+  uint8_t size;                   // text size, as Adafruit's setTextSize()
+  uint8_t first;                  // character of the first cell
+  uint8_t count;                  // cells
+  const uint16_t *offsets;        // of each cell in runs
+  const uint8_t *runs;            // a cell (6 x 8 pixels times size) a row at a time: (length - 1) << 4 | coverage 0..15
+};
+
+struct display_text_line{
+  const char *text;
+  uint8_t len;                    // characters
+};
+
+enum display_scroll_mode{
+  DISPLAY_SCROLL_PAGES,           // lines moving up a page at a time
+  DISPLAY_SCROLL_MARQUEE          // one line moving left
+};
+
+struct display_scroll{
+  display_scroll_mode mode;
+  uint8_t *strip = NULL;          // the whole text, 4 bits per pixel; NULL when not scrolling
+  int16_t strip_w, strip_h;       // pixels
+  int16_t y, h;                   // rows of the screen the strip is seen through
+  int16_t pos;                    // first row (pages) or column (marquee) of the strip in view
+  int16_t step;                   // pixels a step
+  int16_t stop;                   // pauses where pos is a multiple of this
+  uint16_t hold;                  // steps left to pause for
+};
+
+class DisplayPanel : public Adafruit_SSD1327 {
+public:
+  DisplayPanel(uint16_t w, uint16_t h, TwoWire *twi = &Wire, int8_t rst_pin = -1, uint32_t preclk = 400000, uint32_t postclk = 100000);
+  ~DisplayPanel();
+
+  bool begin(uint8_t i2caddr = SSD1327_I2C_ADDRESS, bool reset = true);
+  bool startFlushTask();                              // flush from a task of its own from now on; after begin()
+  void display();                                     // send what changed since the previous display()
+  void invalidate();                                  // send the whole frame next time (e.g. the panel was reset)
+  display_flush_stats lastFlush();
+
+  void drawGreyBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h);            // 4 bits per pixel, from graphics.h
+  void drawRleBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);  // 1 bit run length encoded, from graphics.h
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);   // 1 bit, unlit pixels left as they are
+  void fillSpan(int16_t x, int16_t y, int16_t len, uint16_t color);   // len pixels of row y from x, clipped
+  void setGlyphs(const display_glyphs *atlas, uint8_t sizes);         // GLYPH_ATLAS from glyphs.h
+  void drawText(int16_t x, int16_t y, const char *text, uint8_t size, uint16_t color, uint16_t bg);  // bg == color: transparent
+  bool textFits(int16_t y, const char *text, uint8_t size);           // drawText() shows all of it
+  bool scrollText(int16_t y, const char *text, uint8_t size, uint16_t color, display_scroll_mode mode);  // false if it cannot
+  void stopScroll();
+  bool scrolling(){ return scroll.strip != NULL; }
+  void clearDisplay();                                // and stopScroll()
+
+private:
+  void copyGreyRow(uint8_t *dst, int16_t dst_x, const uint8_t *src, int16_t src_x, int16_t len);
+  const display_glyphs *glyphsFor(uint8_t size);
+  uint8_t layoutText(const char *text, int16_t cols, bool words, display_text_line *lines, uint8_t max_lines);  // lines needed, even past max_lines
+  bool stepScroll(bool redraw);
+  void drawScroll(uint8_t *frame);
+  static void scrollTimer(void *panel);
+  const uint8_t *drawRleRow(int16_t x, int16_t y, const uint8_t *runs, int16_t w, uint16_t color);  // returns the next row's code
+  bool nextWindow(const uint8_t *frame, int16_t from_row, int16_t max_rows, display_window &win);
+  void sendWindow(const display_window &win, const uint8_t *rows);
+  void flush(const uint8_t *frame, int16_t max_rows, bool log);
+  void lockFrame();
+  void unlockFrame();
+  static void flushTask(void *panel);
+
+  uint8_t *shadow = NULL;         // what the panel holds; NULL until begin(), or if it could not be allocated
+  bool shadow_valid = false;
+  uint8_t *front = NULL;          // last frame posted to the flush task
+  uint8_t *slice = NULL;          // rows being sent by the flush task
+  TaskHandle_t flush_task = NULL;
+  SemaphoreHandle_t frame_lock = NULL;  // front, shadow_valid, stats, frame_posted and scroll
+  display_flush_stats stats;
+  bool frame_posted = false;      // by display(), for the flush task
+  display_scroll scroll;
+  esp_timer_handle_t scroll_timer = NULL;
+  volatile bool scroll_due = false;
+  const display_glyphs *glyph_atlas = NULL;
+  uint8_t glyph_sizes = 0;
+};
+
+#endif
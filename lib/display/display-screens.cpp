@@ -0,0 +1,35 @@
+#include "display-screens.h"
+
+// message from y down, scrolling if it does not fit
+static void drawMessage(DisplayPanel &panel, int16_t y, uint8_t size, const char *message, display_scroll_mode scroll){
+  if(panel.textFits(y, message, size) || !panel.scrollText(y, message, size, SSD1327_WHITE, scroll)){
+    panel.drawText(0, y, message, size, SSD1327_WHITE, SSD1327_WHITE);
+  }
+}
+
+void drawTextScreen(DisplayPanel &panel, uint8_t size, const char *message, display_scroll_mode scroll){
+  panel.clearDisplay();
+  drawMessage(panel, 0, size, message, scroll);
+}
+
+void drawTitledScreen(DisplayPanel &panel, const char *title, const char *message){
+  panel.clearDisplay();
+  panel.drawText(0, 0, title, 2, SSD1327_BLACK, SSD1327_WHITE); // 12x16, 'inverted' text
+  panel.drawText(0, 17, message, 1, SSD1327_WHITE, SSD1327_WHITE); // 6x8
+}
+
+void drawGraphicScreen(DisplayPanel &panel, const char *message, const uint8_t *bitmap, uint8_t depth, int16_t w, int16_t h,
+                       display_scroll_mode scroll){
+  int16_t x = (panel.width() - w) / 2;
+
+  panel.clearDisplay();
+  if(depth == 4){ // 16 grey levels, copied a row at a time
+    panel.drawGreyBitmap(x, 0, bitmap, w, h);
+  }
+  else{ // run length encoded
+    panel.drawRleBitmap(x, 0, bitmap, w, h, SSD1327_WHITE);
+  }
+  if(message != NULL && strlen(message) > 0){
+    drawMessage(panel, h, 1, message, scroll);
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef DISPLAY_SCREENS_H
+#define DISPLAY_SCREENS_H
+
+#include <Arduino.h>
+#include "display-panel.h"
+
+/*
+  The screens the chime shows, drawn into a DisplayPanel's frame buffer; sending them (display()) is left to the caller.
+  They are kept out of chime.cpp so that the host-side renderer (src/sim/display-sim.cpp) draws exactly what the board
+  does.
+
+  Text screen: size 1 fits 336 chars (21 chars over 16 lines), size 2 80 chars (10 chars over 8 lines); '\n' starts a
+  new line. Graphic screen: the bitmap centred at the top, size 1 text left justified under it; up to 84 chars (4 full
+  lines) fit under a 96x96 graphic. Lines break between words unless that would not fit (see DisplayPanel::drawText());
+  longer text scrolls, where the panel can (see DisplayPanel::scrollText()).
+*/
+
+// Provided in library
+void drawTextScreen(DisplayPanel &panel, uint8_t size, const char *message, display_scroll_mode scroll = DISPLAY_SCROLL_PAGES);
+void drawTitledScreen(DisplayPanel &panel, const char *title, const char *message);   // title of up to 10 chars
+void drawGraphicScreen(DisplayPanel &panel, const char *message, const uint8_t *bitmap, uint8_t depth, int16_t w, int16_t h,
+                       display_scroll_mode scroll = DISPLAY_SCROLL_PAGES);              // depth 4 grey or 1 run length encoded
+
+#endif
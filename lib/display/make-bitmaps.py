@@ -0,0 +1,395 @@
+#!/usr/bin/env python3
+"""
+Generate include/graphics.h from the PNGs listed in content/graphics/graphics.csv.
+
+    lib/display/make-bitmaps.py
+
+Each PNG is stored at the depth given for it in graphics.csv:
+
+4   16 grey levels, two pixels a byte with the left one in the high nibble, rows padded to a whole byte: the panel's own
+    layout, so DisplayPanel::drawGreyBitmap() copies a row at a time into the frame buffer and anti-aliased edges cost
+    nothing extra to draw. 48 bytes a row at 96 pixels.
+1   one bit per pixel (grey level 128 and up is lit), run length encoded by row, the format drawn by
+    DisplayPanel::drawRleBitmap() (see display-panel.h); a tenth of the flash for jagged edges:
+
+      row       runs of unlit and lit pixels in turn, starting with unlit (which may be 0), each 0..127 and adding up to
+                the width; a longer run is split by a run of 0 of the other kind
+      0x80 | n  the previous row again, n + 1 times
+
+Graphics with a label, and the text styles, also go into GRAPHICS, the table display commands are looked up in with
+findGraphic(): a perfect hash of the label (FNV-1a from a seed chosen here so that no two labels share a slot) picks the
+only entry that can match, so a lookup is one hash and one strcmp however many graphics there are.
+
+With --blob, one PNG is made into a graphic blob instead, to be uploaded at runtime (see lib/graphic-store):
+
+    lib/display/make-bitmaps.py --blob content/graphics/dust-96.png -o SMOKE.gfx
+    test/siren/upload-tone.py SMOKE.gfx --graphic
+
+after which display commands can show it as "SMOKE". At depth 4 (the default) the packed grey rows are compressed with
+PackBits; at depth 1 they are run length encoded as above.
+
+Only the standard library is needed: PNGs are decoded here (8 bit grey, grey+alpha, RGB or RGBA; not interlaced).
+"""
+import argparse
+import csv
+import os
+import struct
+import zlib
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+MAX_SIZE = 128      # DISPLAY_WIDTH, DISPLAY_HEIGHT
+MAX_RUN = 127
+REPEAT = 0x80
+MAX_REPEAT = 128
+THRESHOLD = 128
+DEPTHS = (1, 4)
+DEFAULT_LABEL = "INFO"  # shown for a label that is not in the table
+BLOB_HEADER = struct.Struct("<IHHB3x")  # graphic_blob_header
+BLOB_MAGIC = 0x31584647                 # GRAPHIC_STORE_MAGIC
+
+# label, text size, purpose
+TEXT_STYLES = [
+    ("NONE", 1, "Text only, size 1 (21 chars across, 16 lines)"),
+    ("MEDIUM_TEXT", 2, "Text only, size 2 (max 10 chars across, 6 lines)"),
+    ("LARGE_TEXT", 3, "Text only, size 3 (max  7 chars across, 5 lines)"),
+]
+
+REGISTRY_TYPES = """\
+enum graphic_style : uint8_t {
+  GRAPHIC_TEXT,                   // text only, in text_size
+  GRAPHIC_ICON                    // bitmap centred at the top, size 1 text under it
+};
+
+struct graphic_entry{
+  const char *label;              // as given in display commands; NULL for status screens
+  graphic_style style;
+  uint8_t text_size;
+  uint8_t depth;                  // bits per pixel of bitmap: 4 packed grey, 1 run length encoded; 0 for text
+  const uint8_t *bitmap;          // NULL for text
+  uint16_t width;
+  uint16_t height;
+};
+"""
+
+LOOKUP = """\
+// FNV-1a from GRAPHIC_HASH_SEED
+constexpr uint32_t graphicHash(const char *label, uint32_t hash = GRAPHIC_HASH_SEED){
+  return *label ? graphicHash(label + 1, (hash ^ (uint8_t)*label) * 16777619u) : hash;
+}
+
+// Entry for a display command's graphic label; NULL if there is none
+inline const graphic_entry *findGraphic(const char *label){
+  if(label == NULL){
+    return NULL;
+  }
+  uint8_t i = GRAPHIC_SLOTS[graphicHash(label) % GRAPHIC_HASH_SLOTS];
+  return (i < GRAPHICS_COUNT && strcmp(GRAPHICS[i].label, label) == 0) ? &GRAPHICS[i] : NULL;
+}
+"""
+
+
+def fnv1a(label, seed):
+    h = seed
+    for b in label.encode():
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+def perfect_hash(labels):
+    """Seed and the fewest slots under which every label has a slot of its own. Not a power of two: the low bits of
+    FNV-1a only depend on the low bits of the seed."""
+    slots = len(labels)
+    while True:
+        for seed in range(2166136261, 2166136261 + 20000):
+            if len(set(fnv1a(label, seed) % slots for label in labels)) == len(labels):
+                return seed, slots
+        slots += 1
+
+STATUS_COMMENT = """\
+// ***
+// These graphics below are internal to the device and are used exclusively to indicate device status such as wifi or MQTT broker
+// disconnect or some internal component initialization problem. They are not among the list of graphics that can be set via MQTT.
+"""
+
+
+def read_png(path):
+    """Width, height and rows of grey levels (alpha composited over black, the display's background)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise SystemExit("%s: not a PNG" % path)
+    pos = 8
+    idat = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(colour)
+    if depth != 8 or channels is None or interlace:
+        raise SystemExit("%s: only 8 bit grey, grey+alpha, RGB or RGBA PNGs, not interlaced" % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+            elif kind == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        prev = line
+
+        grey = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            level = px[0] if channels < 3 else (px[0] * 299 + px[1] * 587 + px[2] * 114) // 1000
+            if channels in (2, 4):
+                level = level * px[-1] // 255
+            grey.append(level)
+        rows.append(grey)
+    return width, height, rows
+
+
+def encode_row(row):
+    out = []
+    lit = False
+    x = 0
+    while x < len(row):
+        run = 0
+        while x < len(row) and row[x] == lit:
+            x += 1
+            run += 1
+        while run > MAX_RUN:
+            out += [MAX_RUN, 0]
+            run -= MAX_RUN
+        out.append(run)
+        lit = not lit
+    return out
+
+
+def encode(rows):
+    out = []
+    prev = None
+    repeat = 0
+    for row in rows:
+        if row == prev:
+            repeat += 1
+            if repeat == MAX_REPEAT:
+                out.append(REPEAT | (repeat - 1))
+                repeat = 0
+            continue
+        if repeat:
+            out.append(REPEAT | (repeat - 1))
+            repeat = 0
+        out += encode_row(row)
+        prev = row
+    if repeat:
+        out.append(REPEAT | (repeat - 1))
+    return out
+
+
+def pack(grey):
+    """Rows of 4 bit grey levels, two pixels a byte"""
+    out = []
+    for row in grey:
+        levels = [(level * 15 + 127) // 255 for level in row] + [0]
+        out += [levels[x] << 4 | levels[x + 1] for x in range(0, len(row), 2)]
+    return out
+
+
+def packbits(data):
+    """PackBits: n of 0..127 and n + 1 literal bytes, or 257 - n repeats (n 129..255) of one byte"""
+    out = []
+    literal = []
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            if literal:
+                out += [len(literal) - 1] + literal
+                literal = []
+            out += [257 - run, data[i]]
+        else:
+            literal += data[i:i + run]
+        i += run
+        while len(literal) >= 128:
+            out += [127] + literal[:128]
+            literal = literal[128:]
+    if literal:
+        out += [len(literal) - 1] + literal
+    return out
+
+
+def unpackbits(data):
+    """Inverse of packbits(), to check it"""
+    out = []
+    i = 0
+    while i < len(data):
+        n = data[i]
+        if n < 128:
+            out += data[i + 1:i + 2 + n]
+            i += 2 + n
+        elif n > 128:
+            out += [data[i + 1]] * (257 - n)
+            i += 2
+        else:
+            i += 1
+    return out
+
+
+def write_blob(png, depth, output):
+    width, height, grey = read_png(png)
+    if width > MAX_SIZE or height > MAX_SIZE:
+        raise SystemExit("%s: %dx%d is larger than the display" % (png, width, height))
+    if depth == 4:
+        packed = pack(grey)
+        data = packbits(packed)
+        assert unpackbits(data) == packed
+    else:
+        rows = [[level >= THRESHOLD for level in row] for row in grey]
+        data = encode(rows)
+        assert decode(data, width, height) == rows
+    with open(output, "wb") as f:
+        f.write(BLOB_HEADER.pack(BLOB_MAGIC, width, height, depth) + bytes(data))
+    print("%s: %dx%d, %d bit, %d bytes" % (output, width, height, depth, BLOB_HEADER.size + len(data)))
+
+
+def decode(data, width, height):
+    """Inverse of encode(), to check it"""
+    rows = []
+    pos = 0
+    while len(rows) < height:
+        if data[pos] & REPEAT:
+            rows += [rows[-1]] * ((data[pos] & ~REPEAT) + 1)
+            pos += 1
+            continue
+        row = []
+        lit = False
+        while len(row) < width:
+            row += [lit] * data[pos]
+            pos += 1
+            lit = not lit
+        rows.append(row)
+    return rows
+
+
+def graphics(manifest):
+    with open(manifest) as f:
+        for row in csv.reader(line for line in f if line.strip() and not line.lstrip().startswith("#")):
+            row = [c.strip() for c in row]
+            if len(row) != 5 or not row[0].isidentifier() or not row[3].isdigit() or int(row[3]) not in DEPTHS:
+                raise SystemExit("%s: expected Name, Label, File, Depth (1 or 4), Purpose: %s" % (manifest, ",".join(row)))
+            row[3] = int(row[3])
+            yield row
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate include/graphics.h from content/graphics")
+    parser.add_argument("--manifest", default=os.path.join(ROOT, "content", "graphics", "graphics.csv"))
+    parser.add_argument("-o", "--output", help="default include/graphics.h, or LABEL.gfx named after the PNG with --blob")
+    parser.add_argument("--blob", metavar="PNG", help="make one graphic blob to upload instead")
+    parser.add_argument("--depth", type=int, choices=DEPTHS, default=4, help="of the blob")
+    args = parser.parse_args()
+    if args.blob:
+        name = os.path.splitext(os.path.basename(args.blob))[0].upper()
+        write_blob(args.blob, args.depth, args.output or name + ".gfx")
+        return
+    args.output = args.output or os.path.join(ROOT, "include", "graphics.h")
+
+    labelled = []
+    status = []
+    registry = [(label, "GRAPHIC_TEXT", size, 0, "NULL", 0, 0, purpose) for label, size, purpose in TEXT_STYLES]
+    listing = []
+    plain_total = 0
+    packed_total = 0
+    for name, label, file, depth, purpose in graphics(args.manifest):
+        width, height, grey = read_png(os.path.join(os.path.dirname(args.manifest), file))
+        if width > MAX_SIZE or height > MAX_SIZE:
+            raise SystemExit("%s: %dx%d is larger than the display" % (file, width, height))
+        if depth == 4:
+            data = pack(grey)
+            form = "16 grey levels"
+        else:
+            rows = [[level >= THRESHOLD for level in row] for row in grey]
+            data = encode(rows)
+            assert decode(data, width, height) == rows
+            form = "run length encoded"
+
+        plain = (width + 7) // 8 * height
+        plain_total += plain
+        packed_total += len(data)
+        lines = []
+        entry = ("GRAPHIC_ICON", 1, depth, name + "_BITMAP", width, height)
+        if label:
+            registry.append((label,) + entry + (purpose,))
+        else:
+            listing.append((name + "_GRAPHIC", purpose))
+        lines.append("#define %s_HEIGHT %d\n#define %s_WIDTH %d\n" % (name, height, name, width))
+        lines.append("// %s; %s, %d bytes (%d at one bit per pixel)" % (file, form, len(data), plain))
+        body = ",\n".join("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) for i in range(0, len(data), 16))
+        lines.append("static const unsigned char %s_BITMAP[] PROGMEM  = {\n%s\n};\n" % (name, body))
+        if not label:
+            lines.append("static constexpr graphic_entry %s_GRAPHIC = { NULL, %s, %d, %d, %s, %d, %d };\n" % ((name,) + entry))
+        lines.append("\n")
+        (labelled if label else status).append("\n".join(lines))
+        print("  %-12s %-8s %d bit %5d bytes (%d)" % (name, label, depth, len(data), plain))
+
+    with open(args.output, "w") as f:
+        f.write("#ifndef GRAPHICS_H\n#define GRAPHICS_H\n\n#include <Arduino.h> // for PROGMEM\n\n")
+        f.write("// " + "*" * 117 + "\n")
+        f.write("// Generated by lib/display/make-bitmaps.py from content/graphics/graphics.csv; do not edit. To add a graphic, list\n")
+        f.write("// its PNG (white on black, at most 128x128) in graphics.csv and run the script again.\n")
+        f.write("// Bitmaps are 4 bit grey (DisplayPanel::drawGreyBitmap()) or 1 bit run length encoded by row\n")
+        f.write("// (DisplayPanel::drawRleBitmap()), as given by their entry's depth.\n//\n")
+        f.write("// Graphics for display commands (label: suggested purpose):\n")
+        for entry in registry:
+            f.write("//   %-12s %s\n" % (entry[0], entry[7]))
+        f.write("// Status screens:\n")
+        for name, purpose in listing:
+            f.write("//   %-18s %s\n" % (name, purpose))
+        f.write("\n// *** Data Types ***\n" + REGISTRY_TYPES + "\n")
+        f.writelines(labelled)
+        f.write(STATUS_COMMENT + "\n")
+        f.writelines(status)
+
+        labels = [entry[0] for entry in registry]
+        if len(set(labels)) != len(labels):
+            raise SystemExit("labels must be unique")
+        seed, slots = perfect_hash(labels)
+        table = [0xff] * slots
+        for i, label in enumerate(labels):
+            table[fnv1a(label, seed) % slots] = i
+        f.write("// *" + "*" * 116 + "\n// *** Registry ***\n")
+        f.write("static constexpr graphic_entry GRAPHICS[] = {\n")
+        f.write(",\n".join('  { "%s", %s, %d, %d, %s, %d, %d }' % entry[:7] for entry in registry))
+        f.write("\n};\n\n#define GRAPHICS_COUNT %d\n" % len(registry))
+        f.write("static constexpr const graphic_entry *DEFAULT_GRAPHIC = &GRAPHICS[%d];  // %s, for a label not in the table\n\n"
+                % (labels.index(DEFAULT_LABEL), DEFAULT_LABEL))
+        f.write("#define GRAPHIC_HASH_SEED %du\n#define GRAPHIC_HASH_SLOTS %d\n" % (seed, slots))
+        f.write("// Index into GRAPHICS of the only label that can hash to each slot; 0xff if none does\n")
+        body = ",\n".join("  " + ", ".join("0x%02x" % i for i in table[i:i + 16]) for i in range(0, len(table), 16))
+        f.write("static constexpr uint8_t GRAPHIC_SLOTS[GRAPHIC_HASH_SLOTS] = {\n%s\n};\n\n" % body)
+        f.write(LOOKUP + "\n#endif\n")
+    print("%s: %d bytes of bitmaps (%d at one bit per pixel)" % (os.path.relpath(args.output), packed_total, plain_total))
+
+
+if __name__ == "__main__":
+    main()
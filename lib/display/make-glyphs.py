@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Generate include/glyphs.h: Adafruit GFX's built in 5x7 font (glcdfont.c) rasterised at text sizes 1, 2 and 3, for
+DisplayPanel::drawText() (see display-panel.h).
+
+    lib/display/make-glyphs.py [--font path/to/glcdfont.c] [--no-aa]
+
+glyphs.h is committed, as graphics.h is, so neither the board nor the host renderer (and its golden images) depends on
+a copy of Adafruit GFX being installed. Run this again after changing it, with --font pointing at glcdfont.c in the
+board's libdeps (the default, once the board has been built), and commit the result.
+
+Each character cell (6 x 8 pixels at size 1, the font's 5 columns and a blank one, times the size) is stored a row at a
+time as runs of equal coverage, one byte each: (length - 1) << 4 | coverage, coverage 0 (background) to 15 (text
+colour), a run no longer than 16 pixels. drawText() fills a run of full or no coverage with fillSpan() and blends only
+the pixels in between, so a glyph is drawn a span at a time rather than a pixel at a time.
+
+Sizes 2 and 3 are anti-aliased unless --no-aa: the font's pixels are scaled up with the corners where a diagonal
+stroke steps from one pixel to the next filled in by a half pixel triangle, rendered 4x4 times over and averaged to 16
+grey levels. Size 1 is the font as it is.
+"""
+import argparse
+import os
+import re
+
+SIZES = (1, 2, 3)
+FIRST = 0x20            # ' '
+LAST = 0x7e             # '~'; others are drawn with Adafruit_GFX::drawChar()
+SUPERSAMPLE = 4
+MAX_RUN = 16
+FONT_IN_LIBDEPS = os.path.join(".pio", "libdeps", "featheresp32-s2", "Adafruit GFX Library", "glcdfont.c")
+
+
+def read_font(path):
+    """5 column bytes per character, least significant bit at the top, as in glcdfont.c"""
+    with open(path) as f:
+        text = f.read()
+    start = text.index("{", text.index("font[]"))
+    data = [int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", re.sub(r"/\*.*?\*/", "", text[start:text.index("};", start)], flags=re.S))]
+    if len(data) < (LAST + 1) * 5:
+        raise SystemExit("%s: expected a 5 byte glyph per character, found %d bytes" % (path, len(data)))
+    return data
+
+
+def lit(font, c, x, y):
+    return 0 <= x < 5 and 0 <= y < 8 and (font[c * 5 + x] >> y) & 1
+
+
+def covered(font, c, px, py):
+    """Whether a point of the cell (in font pixels) is inside the smoothed glyph"""
+    x, y = int(px), int(py)
+    if lit(font, c, x, y):
+        return True
+    fx, fy = px - x, py - y
+    # an unlit pixel between two lit ones that touch at a corner: fill the half pixel triangle at that corner
+    for dx, dy in ((-1, -1), (1, -1), (-1, 1), (1, 1)):
+        if lit(font, c, x + dx, y) and lit(font, c, x, y + dy):
+            ex = fx if dx < 0 else 1 - fx
+            ey = fy if dy < 0 else 1 - fy
+            if ex + ey < 0.5:
+                return True
+    return False
+
+
+def rasterise(font, c, size, aa):
+    """Rows of coverage 0..15 of a 6 * size x 8 * size cell"""
+    rows = []
+    for y in range(8 * size):
+        row = []
+        for x in range(6 * size):
+            if not aa or size == 1:
+                row.append(15 if lit(font, c, x // size, y // size) else 0)
+                continue
+            n = SUPERSAMPLE * SUPERSAMPLE
+            hits = sum(covered(font, c, (x + (i + 0.5) / SUPERSAMPLE) / size, (y + (j + 0.5) / SUPERSAMPLE) / size)
+                       for i in range(SUPERSAMPLE) for j in range(SUPERSAMPLE))
+            row.append((hits * 15 + n // 2) // n)
+        rows.append(row)
+    return rows
+
+
+def encode(rows):
+    out = []
+    for row in rows:
+        x = 0
+        while x < len(row):
+            run = 1
+            while x + run < len(row) and run < MAX_RUN and row[x + run] == row[x]:
+                run += 1
+            out.append((run - 1) << 4 | row[x])
+            x += run
+    return out
+
+
+def decode(data, width, height):
+    """Inverse of encode(), to check it"""
+    rows = []
+    pos = 0
+    for _ in range(height):
+        row = []
+        while len(row) < width:
+            row += [data[pos] & 0x0f] * ((data[pos] >> 4) + 1)
+            pos += 1
+        rows.append(row)
+    return rows
+
+
+def array(kind, name, values, per_line, fmt):
+    body = ",\n".join("  " + ", ".join(fmt % v for v in values[i:i + per_line]) for i in range(0, len(values), per_line))
+    return "static const %s %s[] PROGMEM = {\n%s\n};\n" % (kind, name, body)
+
+
+def generate(font_path, output, aa):
+    font = read_font(font_path)
+    atlases = []
+    total = 0
+    with open(output, "w") as f:
+        f.write("#ifndef GLYPHS_H\n#define GLYPHS_H\n\n#include \"display-panel.h\"\n\n")
+        f.write("// " + "*" * 117 + "\n")
+        f.write("// Generated by lib/display/make-glyphs.py from Adafruit GFX's glcdfont.c%s; do not edit.\n" % ("" if aa else " (--no-aa)"))
+        f.write("// Characters 0x%02x to 0x%02x at text sizes %s, a row at a time as runs of (length - 1) << 4 | coverage;\n"
+                % (FIRST, LAST, ", ".join(str(s) for s in SIZES)))
+        f.write("// see DisplayPanel::drawText().\n\n")
+        for size in SIZES:
+            offsets = []
+            runs = []
+            for c in range(FIRST, LAST + 1):
+                rows = rasterise(font, c, size, aa)
+                data = encode(rows)
+                assert decode(data, 6 * size, 8 * size) == rows
+                offsets.append(len(runs))
+                runs += data
+            f.write(array("uint16_t", "GLYPH_OFFSETS_%d" % size, offsets, 16, "%d"))
+            f.write(array("uint8_t", "GLYPH_RUNS_%d" % size, runs, 16, "0x%02x") + "\n")
+            atlases.append("  { %d, 0x%02x, %d, GLYPH_OFFSETS_%d, GLYPH_RUNS_%d }" % (size, FIRST, LAST - FIRST + 1, size, size))
+            total += len(runs) + 2 * len(offsets)
+        f.write("static const display_glyphs GLYPH_ATLAS[] = {\n%s\n};\n" % ",\n".join(atlases))
+        f.write("#define GLYPH_ATLAS_COUNT %d\n\n#endif\n" % len(SIZES))
+    print("%s: %d bytes of glyphs" % (os.path.relpath(output), total))
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+    parser = argparse.ArgumentParser(description="Generate include/glyphs.h from Adafruit GFX's glcdfont.c")
+    parser.add_argument("--font", default=os.path.join(root, FONT_IN_LIBDEPS))
+    parser.add_argument("-o", "--output", default=os.path.join(root, "include", "glyphs.h"))
+    parser.add_argument("--no-aa", action="store_true", help="sizes 2 and 3 as plain scaled up pixels")
+    args = parser.parse_args()
+    generate(args.font, args.output, not args.no_aa)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,296 @@
+#include "graphic-store.h"
+
+static char graphic_dir[GRAPHIC_STORE_LABEL_LEN * 2] = "";
+static char labels[GRAPHIC_STORE_MAX_GRAPHICS][GRAPHIC_STORE_LABEL_LEN];   // on the card
+static size_t label_count = 0;
+static graphic_asset entries[GRAPHIC_STORE_MAX_ENTRIES];
+static size_t cache_budget = 0;
+static size_t cache_used = 0;
+static uint32_t lookups = 0;
+static graphic_store_stats stats;
+
+// label of a file in the graphics directory; false if it is not a graphic
+static bool labelOf(const char *name, char *label){
+  size_t len = strlen(name);
+  size_t ext = strlen(GRAPHIC_STORE_EXTENSION);
+  if(name[0] == '.' || len <= ext || len - ext >= GRAPHIC_STORE_LABEL_LEN || strcasecmp(name + len - ext, GRAPHIC_STORE_EXTENSION) != 0){
+    return false;
+  }
+  memcpy(label, name, len - ext);
+  label[len - ext] = '\0';
+  return true;
+}
+
+static bool listed(const char *label){
+  for(size_t i = 0; i < label_count; i++){
+    if(strcmp(labels[i], label) == 0){
+      return true;
+    }
+  }
+  return false;
+}
+
+static int findEntry(const char *label){
+  for(int i = 0; i < GRAPHIC_STORE_MAX_ENTRIES; i++){
+    if(entries[i].bitmap != NULL && strcmp(entries[i].label, label) == 0){
+      return i;
+    }
+  }
+  return -1;
+}
+
+static void evict(int i){
+  free(entries[i].bitmap);
+  cache_used -= entries[i].size;
+  entries[i].bitmap = NULL;
+  entries[i].size = 0;
+  entries[i].label[0] = '\0';
+}
+
+// Evict least recently used graphics until size bytes fit within the budget and a slot is free; -1 if they never will
+static int makeRoom(size_t size){
+  if(size > cache_budget){
+    return -1;
+  }
+  while(true){
+    int free_slot = -1;
+    int lru = -1;
+    for(int i = 0; i < GRAPHIC_STORE_MAX_ENTRIES; i++){
+      if(entries[i].bitmap == NULL){
+        if(free_slot < 0){ free_slot = i; }
+      }
+      else if(lru < 0 || entries[i].last_used < entries[lru].last_used){
+        lru = i;
+      }
+    }
+    if(free_slot >= 0 && cache_used + size <= cache_budget){
+      return free_slot;
+    }
+    evict(lru);
+  }
+}
+
+static bool unpackBits(const uint8_t *src, size_t len, uint8_t *dst, size_t out_len){
+  size_t i = 0;
+  size_t o = 0;
+  while(i < len){
+    int8_t n = (int8_t)src[i++];
+    if(n >= 0){ // literal
+      size_t run = n + 1;
+      if(i + run > len || o + run > out_len){
+        return false;
+      }
+      memcpy(dst + o, src + i, run);
+      i += run;
+      o += run;
+    }
+    else if(n != -128){ // repeat
+      size_t run = 1 - n;
+      if(i >= len || o + run > out_len){
+        return false;
+      }
+      memset(dst + o, src[i++], run);
+      o += run;
+    }
+  }
+  return o == out_len;
+}
+
+// Runs of every row add up to the width, without reading past the end
+static bool checkRle(const uint8_t *data, size_t len, uint16_t width, uint16_t height){
+  size_t i = 0;
+  for(uint32_t rows = 0; rows < height; ){
+    if(i >= len){
+      return false;
+    }
+    if(data[i] & 0x80){ // repeat of the previous row
+      if(rows == 0){
+        return false;
+      }
+      rows += (data[i++] & 0x7f) + 1;
+      continue;
+    }
+    uint32_t col = 0;
+    while(col < width){
+      if(i >= len || (data[i] & 0x80)){
+        return false;
+      }
+      col += data[i++];
+    }
+    if(col != width){
+      return false;
+    }
+    rows++;
+  }
+  return true;
+}
+
+bool graphicStoreCheckHeader(const uint8_t *data, size_t len){
+  graphic_blob_header header;
+  if(len < sizeof(header)){
+    return false;
+  }
+  memcpy(&header, data, sizeof(header));
+  return header.magic == GRAPHIC_STORE_MAGIC && (header.depth == 4 || header.depth == 1)
+    && header.width > 0 && header.width <= GRAPHIC_STORE_MAX_SIZE && header.height > 0 && header.height <= GRAPHIC_STORE_MAX_SIZE;
+}
+
+bool graphicStoreCheckName(const char *name){
+  char label[GRAPHIC_STORE_LABEL_LEN];
+  return labelOf(name, label);
+}
+
+bool initGraphicStore(const char *dir, size_t budget){
+  if(!psramFound()){
+    Sprintln(F("No PSRAM; uploaded graphics disabled"));
+    return false;
+  }
+  if(strlen(dir) >= sizeof(graphic_dir)){
+    return false;
+  }
+  strcpy(graphic_dir, dir);
+  cache_budget = budget;
+
+  audioLock(); // SD card is shared with the audio task
+  File d = SD.open(graphic_dir);
+  if(!d){
+    SD.mkdir(graphic_dir);
+  }
+  while(d){
+    File entry = d.openNextFile();
+    if(!entry){
+      break;
+    }
+    char label[GRAPHIC_STORE_LABEL_LEN];
+    if(!entry.isDirectory() && labelOf(entry.name(), label)){
+      if(label_count < GRAPHIC_STORE_MAX_GRAPHICS){
+        strcpy(labels[label_count++], label);
+      }
+      else{
+        Sprint(F("Too many graphics; not listed: ")); Sprintln(entry.name());
+      }
+    }
+    entry.close();
+  }
+  if(d){
+    d.close();
+  }
+  audioUnlock();
+
+  Sprint(F("Uploaded graphics: ")); Sprintln(label_count);
+  return true;
+}
+
+// Read <label>.gfx into a cache slot; -1 if it cannot be
+static int load(const char *label){
+  char path[sizeof(graphic_dir) + GRAPHIC_STORE_LABEL_LEN + sizeof(GRAPHIC_STORE_EXTENSION)];
+  snprintf(path, sizeof(path), "%s/%s" GRAPHIC_STORE_EXTENSION, graphic_dir, label);
+
+  graphic_blob_header header = {};
+  audioLock();
+  File f = SD.open(path);
+  size_t size = f ? f.size() : 0;
+  bool valid = f && size > sizeof(header) && f.read((uint8_t *)&header, sizeof(header)) == sizeof(header)
+    && graphicStoreCheckHeader((const uint8_t *)&header, sizeof(header));
+  audioUnlock();
+
+  size_t data_len = valid ? size - sizeof(header) : 0;
+  size_t bitmap_size = header.depth == 4 ? (size_t)(header.width + 1) / 2 * header.height : data_len;
+  uint8_t *data = valid && bitmap_size <= cache_budget ? (uint8_t *)ps_malloc(data_len) : NULL;
+
+  size_t total = 0;
+  while(data != NULL && total < data_len){
+    audioLock();
+    int n = f.read(data + total, min((size_t)GRAPHIC_STORE_READ_CHUNK, data_len - total));
+    audioUnlock();
+    if(n <= 0){
+      break;
+    }
+    total += n;
+  }
+  audioLock();
+  if(f){
+    f.close();
+  }
+  audioUnlock();
+
+  uint8_t *bitmap = NULL;
+  if(data != NULL && total == data_len){
+    if(header.depth == 4){
+      bitmap = (uint8_t *)ps_malloc(bitmap_size);
+      if(bitmap != NULL && !unpackBits(data, data_len, bitmap, bitmap_size)){
+        free(bitmap);
+        bitmap = NULL;
+      }
+      free(data);
+    }
+    else if(checkRle(data, data_len, header.width, header.height)){
+      bitmap = data;
+    }
+    else{
+      free(data);
+    }
+  }
+  else{
+    free(data);
+  }
+  if(bitmap == NULL){
+    Sprint(F("Failed to load graphic: ")); Sprintln(path);
+    return -1;
+  }
+
+  // only now, so a graphic that fails to load does not cost the others their place
+  int slot = makeRoom(bitmap_size);
+  graphic_asset &e = entries[slot];
+  strcpy(e.label, label);
+  e.width = header.width;
+  e.height = header.height;
+  e.depth = header.depth;
+  e.bitmap = bitmap;
+  e.size = bitmap_size;
+  cache_used += bitmap_size;
+  return slot;
+}
+
+const graphic_asset *graphicStoreFind(const char *label){
+  if(label == NULL || cache_budget == 0 || !listed(label)){
+    return NULL;
+  }
+  lookups++;
+  int i = findEntry(label);
+  if(i >= 0){
+    stats.hits++;
+  }
+  else{
+    unsigned long start = micros();
+    i = load(label);
+    if(i < 0){
+      stats.failed++;
+      return NULL;
+    }
+    stats.misses++;
+    stats.last_load_us = micros() - start;
+    stats.max_load_us = max(stats.max_load_us, stats.last_load_us);
+    Sprint(F("Graphic loaded: ")); Sprint(label); Sprint(F(" in ")); Sprint(stats.last_load_us); Sprintln(F("us"));
+  }
+  entries[i].last_used = lookups;
+  return &entries[i];
+}
+
+void graphicStoreInstalled(const char *name){
+  char label[GRAPHIC_STORE_LABEL_LEN];
+  if(cache_budget == 0 || !labelOf(name, label)){
+    return;
+  }
+  int i = findEntry(label);
+  if(i >= 0){
+    evict(i); // the old version
+  }
+  if(!listed(label) && label_count < GRAPHIC_STORE_MAX_GRAPHICS){
+    strcpy(labels[label_count++], label);
+  }
+}
+
+const graphic_store_stats &graphicStoreStats(){
+  return stats;
+}
@@ -0,0 +1,79 @@
+#ifndef GRAPHIC_STORE_H
+#define GRAPHIC_STORE_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "log.h"
+
+/*
+  Graphics for display commands added at runtime, on top of the ones compiled into graphics.h.
+
+  A graphic is uploaded over MQTT like a tone (see tone-upload.h, kind "graphic") as a blob made from a PNG by
+  lib/display/make-bitmaps.py --blob, and kept on the SD card as <label>.gfx in the graphics directory. The labels on
+  the card are listed at boot and whenever a graphic is installed, so a display command for a label that was never
+  uploaded (every built-in one) is turned away without touching the card.
+
+  A graphic is read from the card the first time it is shown and kept, decoded, in PSRAM; when the budget is used up
+  the least recently shown graphic is dropped. Hits, misses and how long the misses took to load are counted in
+  graphic_store_stats.
+
+  Blob: a graphic_blob_header, then the pixels at the header's depth:
+    4  16 grey levels, two pixels a byte, rows padded to a whole byte (DisplayPanel::drawGreyBitmap()'s format),
+       compressed with PackBits: a control byte n of 0..127 is followed by n + 1 literal bytes, one of 129..255 by a
+       byte repeated 257 - n times; 128 is ignored. Unpacked when loaded.
+    1  one bit per pixel, run length encoded by row as in graphics.h (DisplayPanel::drawRleBitmap()). Kept as it is.
+
+  Called from one task only, normally loop().
+*/
+
+#define GRAPHIC_STORE_MAX_GRAPHICS 32     // labels listed from the graphics directory
+#define GRAPHIC_STORE_LABEL_LEN 16        // with the terminator; a display command's graphic is up to 15 characters
+#define GRAPHIC_STORE_MAX_ENTRIES 16      // graphics held in PSRAM at once
+#define GRAPHIC_STORE_READ_CHUNK 2048     // bytes read from SD per lock; lets the audio task feed the codec in between
+#define GRAPHIC_STORE_MAX_SIZE 128        // pixels across and down; the display's size
+#define GRAPHIC_STORE_EXTENSION ".gfx"
+#define GRAPHIC_STORE_MAGIC 0x31584647    // "GFX1"
+
+// *********************************************************************************************************************
+// *** Data Types ***
+// Start of a blob; little endian
+struct graphic_blob_header{
+  uint32_t magic;
+  uint16_t width;
+  uint16_t height;
+  uint8_t depth;                  // 4 or 1; see above
+  uint8_t reserved[3];
+};
+
+struct graphic_asset{
+  char label[GRAPHIC_STORE_LABEL_LEN];  // empty if slot unused
+  uint16_t width;
+  uint16_t height;
+  uint8_t depth;
+  uint8_t *bitmap;                // in PSRAM; 4 bit grey unpacked, 1 bit run length encoded
+  size_t size;                    // bytes of bitmap
+  uint32_t last_used;             // lookup count at the last hit or load; for LRU eviction
+};
+
+struct graphic_store_stats{
+  uint32_t hits = 0;              // found in PSRAM
+  uint32_t misses = 0;            // read from the card
+  uint32_t failed = 0;            // on the card but unreadable or malformed
+  uint32_t last_load_us = 0;      // reading and decoding the most recent miss
+  uint32_t max_load_us = 0;
+};
+
+// *********************************************************************************************************************
+// *** Must Implement ***
+void audioLock();                 // provided by audio-player; guards SD card access
+void audioUnlock();
+
+// Provided in library
+bool initGraphicStore(const char *dir, size_t budget);        // list the graphics directory (created if missing); false if no PSRAM
+const graphic_asset *graphicStoreFind(const char *label);     // NULL if not uploaded; valid until the next call
+bool graphicStoreCheckName(const char *name);                 // <label>.gfx, with a label short enough
+bool graphicStoreCheckHeader(const uint8_t *data, size_t len);  // start of a blob, as the first chunk of an upload
+void graphicStoreInstalled(const char *name);                 // <label>.gfx was added or replaced in the directory
+const graphic_store_stats &graphicStoreStats();
+
+#endif
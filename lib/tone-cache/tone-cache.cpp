@@ -0,0 +1,210 @@
+#include "tone-cache.h"
+
+static cached_tone entries[TONE_CACHE_MAX_ENTRIES];
+static SemaphoreHandle_t cache_mutex = NULL;
+static size_t cache_budget = 0;
+static size_t cache_used = 0;
+static char pending_path[TONE_CACHE_PATH_LEN] = "";
+
+// caller must hold cache_mutex
+static int findEntry(const char *path){
+  for(int i = 0; i < TONE_CACHE_MAX_ENTRIES; i++){
+    if(entries[i].data != NULL && strcmp(entries[i].path, path) == 0){
+      return i;
+    }
+  }
+  return -1;
+}
+
+// caller must hold cache_mutex
+static void evict(int i){
+  Sprint(F("Tone cache evict: ")); Sprintln(entries[i].path);
+  free(entries[i].data);
+  cache_used -= entries[i].size;
+  entries[i].data = NULL;
+  entries[i].size = 0;
+  entries[i].path[0] = '\0';
+}
+
+/*
+  Evict least recently used, unpinned tones until size bytes fit within the budget and a slot is free.
+  Returns free slot index, or -1 if that is not possible. Caller must hold cache_mutex.
+*/
+static int makeRoom(size_t size){
+  while(true){
+    int free_slot = -1;
+    int lru = -1;
+    for(int i = 0; i < TONE_CACHE_MAX_ENTRIES; i++){
+      if(entries[i].data == NULL){
+        if(free_slot < 0){ free_slot = i; }
+      }
+      else if(entries[i].users == 0 && (lru < 0 || entries[i].last_used < entries[lru].last_used)){
+        lru = i;
+      }
+    }
+    if(free_slot >= 0 && cache_used + size <= cache_budget){
+      return free_slot;
+    }
+    if(lru < 0){
+      return -1; // everything left is playing
+    }
+    evict(lru);
+  }
+}
+
+bool initToneCache(size_t budget){
+  if(!psramFound()){
+    Sprintln(F("No PSRAM; tone cache disabled"));
+    return false;
+  }
+  cache_mutex = xSemaphoreCreateMutex();
+  if(cache_mutex == NULL){
+    return false;
+  }
+  cache_budget = min(budget, (size_t)ESP.getFreePsram());
+  Sprint(F("Tone cache budget: ")); Sprintln(cache_budget);
+  return true;
+}
+
+bool toneCacheLoad(const char *path){
+  if(cache_mutex == NULL || strlen(path) >= TONE_CACHE_PATH_LEN){
+    return false;
+  }
+
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  bool cached = findEntry(path) >= 0;
+  xSemaphoreGive(cache_mutex);
+  if(cached){
+    return true;
+  }
+
+  audioLock();
+  File f = SD.open(path);
+  size_t size = f ? f.size() : 0;
+  audioUnlock();
+  if(size == 0 || size > cache_budget){
+    Sprint(F("Tone not cacheable: ")); Sprintln(path);
+    audioLock();
+    if(f){ f.close(); }
+    audioUnlock();
+    return false;
+  }
+
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  int slot = makeRoom(size);
+  uint8_t *data = slot >= 0 ? (uint8_t *)ps_malloc(size) : NULL;
+  if(data != NULL){
+    // reserve the budget now; the slot only becomes visible once fully read
+    cache_used += size;
+  }
+  xSemaphoreGive(cache_mutex);
+
+  size_t total = 0;
+  if(data != NULL){
+    while(total < size){
+      // hold the SD card for one chunk at a time so the audio task can keep the codec fed
+      audioLock();
+      int n = f.read(data + total, min((size_t)TONE_CACHE_READ_CHUNK, size - total));
+      audioUnlock();
+      if(n <= 0){
+        break;
+      }
+      total += n;
+    }
+  }
+  audioLock();
+  f.close();
+  audioUnlock();
+
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  bool loaded = data != NULL && total == size;
+  if(loaded){
+    strcpy(entries[slot].path, path);
+    entries[slot].data = data;
+    entries[slot].size = size;
+    entries[slot].last_used = millis();
+    entries[slot].users = 0;
+  }
+  else if(data != NULL){
+    cache_used -= size;
+    free(data);
+  }
+  xSemaphoreGive(cache_mutex);
+
+  Sprint(loaded ? F("Tone cached: ") : F("Failed to cache tone: ")); Sprintln(path);
+  return loaded;
+}
+
+int toneCacheAcquire(const char *path, const uint8_t **data, size_t *size){
+  if(cache_mutex == NULL){
+    return -1;
+  }
+
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  int i = findEntry(path);
+  if(i >= 0){
+    entries[i].users++;
+    entries[i].last_used = millis();
+    *data = entries[i].data;
+    *size = entries[i].size;
+  }
+  else if(strlen(path) < TONE_CACHE_PATH_LEN){
+    // remember miss so it can be loaded once the player is idle
+    strcpy(pending_path, path);
+  }
+  xSemaphoreGive(cache_mutex);
+
+  return i;
+}
+
+void toneCacheRelease(int handle){
+  if(cache_mutex == NULL || handle < 0 || handle >= TONE_CACHE_MAX_ENTRIES){
+    return;
+  }
+
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  if(entries[handle].users > 0){
+    entries[handle].users--;
+  }
+  xSemaphoreGive(cache_mutex);
+}
+
+bool toneCacheForget(const char *path){
+  if(cache_mutex == NULL){
+    return true;
+  }
+
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  int i = findEntry(path);
+  bool forgotten = i < 0 || entries[i].users == 0;
+  if(i >= 0 && forgotten){
+    evict(i);
+  }
+  xSemaphoreGive(cache_mutex);
+  return forgotten;
+}
+
+bool toneCacheLoadPending(){
+  if(cache_mutex == NULL){
+    return false;
+  }
+
+  char path[TONE_CACHE_PATH_LEN];
+  xSemaphoreTake(cache_mutex, portMAX_DELAY);
+  strcpy(path, pending_path);
+  pending_path[0] = '\0';
+  xSemaphoreGive(cache_mutex);
+
+  if(path[0] == '\0'){
+    return false;
+  }
+  return toneCacheLoad(path);
+}
+
+size_t toneCacheUsed(){
+  return cache_used;
+}
+
+size_t toneCacheBudget(){
+  return cache_budget;
+}
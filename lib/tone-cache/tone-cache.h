@@ -0,0 +1,50 @@
+#ifndef TONE_CACHE_H
+#define TONE_CACHE_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "log.h"
+
+/*
+  Keeps whole tone files in PSRAM so that playback can start without opening a FAT file over the SPI bus shared with the codec.
+
+  Tones are loaded either up-front (toneCacheLoad() at boot) or on first use: a miss in toneCacheAcquire() remembers the path and
+  the main program later calls toneCacheLoadPending() while the player is idle. The SD card is then only read on a cache miss.
+  When the budget is exhausted the least recently used tone that is not currently playing is evicted.
+
+  Loading (toneCacheLoad(), toneCacheLoadPending()) must only be done from one task, normally loop(). Acquire and release are
+  safe to call from the audio task at any time.
+*/
+
+#define TONE_CACHE_MAX_ENTRIES 16
+#define TONE_CACHE_PATH_LEN 64
+#define TONE_CACHE_READ_CHUNK 4096    // bytes read from SD per lock; lets the audio task feed the codec in between
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct cached_tone{
+  char path[TONE_CACHE_PATH_LEN]; // full path on SD card; empty if slot unused
+  uint8_t *data;                  // whole file, allocated in PSRAM
+  size_t size;
+  unsigned long last_used;        // millis() of last acquire; used for LRU eviction
+  uint8_t users;                  // >0 while being played; never evicted
+};
+
+// *********************************************************************************************************************
+// *** Must Implement ***
+void audioLock();                 // provided by audio-player; guards SD card access
+void audioUnlock();
+
+// Provided in library
+bool initToneCache(size_t budget);                                              // budget in bytes of PSRAM; false if no PSRAM
+bool toneCacheLoad(const char *path);                                           // read whole file into PSRAM, evicting LRU tones as needed
+int toneCacheAcquire(const char *path, const uint8_t **data, size_t *size);     // returns handle >= 0 on hit (pins tone), -1 on miss
+void toneCacheRelease(int handle);                                              // unpin tone once playback ends
+bool toneCacheForget(const char *path);                                         // drop a tone replaced on the SD card; false if it is playing
+bool toneCacheLoadPending();                                                    // load the most recent miss, if any; call while idle
+size_t toneCacheUsed();                                                         // bytes of PSRAM currently held by the cache
+size_t toneCacheBudget();
+
+#endif
@@ -0,0 +1,378 @@
+#include "tone-index.h"
+
+static char tone_dir[TONE_INDEX_NAME_LEN * 2] = "";
+static char index_file[TONE_INDEX_NAME_LEN * 2] = "";
+static tone_record records[TONE_INDEX_MAX_TONES];
+static size_t record_count = 0;
+static int8_t buckets[TONE_INDEX_BUCKETS];    // index into records, or -1 if empty
+
+static uint32_t le32(const uint8_t *p){
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// FNV-1a
+static uint32_t hashName(const char *name){
+  uint32_t h = 2166136261u;
+  while(*name){
+    h = (h ^ (uint8_t)*name++) * 16777619u;
+  }
+  return h;
+}
+
+static void rebuildBuckets(){
+  memset(buckets, -1, sizeof(buckets));
+  for(size_t i = 0; i < record_count; i++){
+    uint32_t b = hashName(records[i].name) & (TONE_INDEX_BUCKETS - 1);
+    while(buckets[b] >= 0){
+      b = (b + 1) & (TONE_INDEX_BUCKETS - 1); // linear probing
+    }
+    buckets[b] = i;
+  }
+}
+
+// Any record, including tones that were rejected
+static const tone_record *findRecord(const char *name){
+  if(record_count == 0){
+    return NULL; // buckets are not built until the index is loaded
+  }
+  uint32_t b = hashName(name) & (TONE_INDEX_BUCKETS - 1);
+  while(buckets[b] >= 0){
+    if(strcmp(records[buckets[b]].name, name) == 0){
+      return &records[buckets[b]];
+    }
+    b = (b + 1) & (TONE_INDEX_BUCKETS - 1);
+  }
+  return NULL;
+}
+
+/*
+  Size of the ID3v2 tag at the start of an mp3, or 0 if there is none.
+  In-memory equivalent of Adafruit_VS1053_FilePlayer::mp3_ID3Jumper().
+*/
+static size_t id3Length(const uint8_t *data, size_t size){
+  if(size < 10 || data[0] != 'I' || data[1] != 'D' || data[2] != '3'){
+    return 0;
+  }
+  // tag size is a 28 bit "syncsafe" integer (7 bits per byte), excluding the 10 byte header
+  size_t len = ((size_t)(data[6] & 0x7f) << 21) | ((size_t)(data[7] & 0x7f) << 14) | ((size_t)(data[8] & 0x7f) << 7) | (data[9] & 0x7f);
+  return len + 10;
+}
+
+/*
+  Locate a RIFF chunk in a WAV header; returns the offset of the chunk's header, or 0 if it is not within the data.
+  Positions are 32 bit, as size_t is on the board, so the host simulator walks a header exactly as the ESP32 does.
+*/
+static size_t wavChunk(const uint8_t *data, size_t size, const char *id){
+  uint32_t pos = 12;
+  while(pos + 8 <= size){
+    if(memcmp(data + pos, id, 4) == 0){
+      return pos;
+    }
+    uint32_t chunk_len = le32(data + pos + 4);
+    if(chunk_len >= size - pos - 8){
+      break; // the next chunk is not within the data; a corrupt length would otherwise wrap pos round and never end
+    }
+    pos += 8 + chunk_len + (chunk_len & 1); // chunks are word aligned
+  }
+  return 0;
+}
+
+// true for an MPEG audio or ADTS frame sync
+static bool frameSync(const uint8_t *data){
+  return data[0] == 0xFF && (data[1] & 0xE0) == 0xE0;
+}
+
+tone_codec toneParseHeader(const uint8_t *header, size_t len, uint32_t *data_offset, int32_t *wav_length_field){
+  *data_offset = 0;
+  *wav_length_field = -1;
+
+  if(len >= 12 && memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0){
+    // the data chunk may lie beyond len if the header carries large metadata chunks; the decoder copes, only repeats rewind to 0
+    size_t pos = wavChunk(header, len, "data");
+    if(pos > 0){
+      *wav_length_field = pos + 4;
+      *data_offset = pos + 8;
+    }
+    return TONE_CODEC_WAV;
+  }
+  size_t id3 = id3Length(header, len);
+  if(id3 > 0){
+    *data_offset = id3;
+    return TONE_CODEC_MP3;
+  }
+  if(len >= 4 && memcmp(header, "OggS", 4) == 0){ return TONE_CODEC_OGG; }
+  if(len >= 4 && memcmp(header, "fLaC", 4) == 0){ return TONE_CODEC_FLAC; }
+  if(len >= 4 && memcmp(header, "MThd", 4) == 0){ return TONE_CODEC_MIDI; }
+  if(len >= 8 && memcmp(header + 4, "ftyp", 4) == 0){ return TONE_CODEC_AAC; }  // MP4/M4A
+  if(len >= 2 && frameSync(header)){
+    // layer bits of 00 mark an ADTS AAC stream rather than MPEG audio
+    return (header[1] & 0x06) == 0 ? TONE_CODEC_AAC : TONE_CODEC_MP3;
+  }
+  return TONE_CODEC_UNKNOWN;
+}
+
+const char *toneCodecName(uint8_t codec){
+  switch(codec){
+    case TONE_CODEC_MP3: return "mp3";
+    case TONE_CODEC_WAV: return "wav";
+    case TONE_CODEC_OGG: return "ogg";
+    case TONE_CODEC_AAC: return "aac";
+    case TONE_CODEC_FLAC: return "flac";
+    case TONE_CODEC_MIDI: return "midi";
+    default: return "unknown";
+  }
+}
+
+/*
+  Duration of an mp3 from its first frame header, assuming a constant bit rate (VBR files are estimated from their first frame).
+  Only layer III is recognised; returns 0 otherwise.
+*/
+static uint32_t mp3Duration(const uint8_t *frame, uint32_t audio_bytes){
+  static const uint16_t mpeg1_kbps[16] = { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0 };
+  static const uint16_t mpeg2_kbps[16] = { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0 };
+
+  uint8_t version = (frame[1] >> 3) & 0x03;   // 3 = MPEG1, 2 = MPEG2, 0 = MPEG2.5
+  uint8_t layer = (frame[1] >> 1) & 0x03;     // 1 = layer III
+  if(!frameSync(frame) || version == 1 || layer != 1){
+    return 0;
+  }
+  uint16_t kbps = (version == 3 ? mpeg1_kbps : mpeg2_kbps)[frame[2] >> 4];
+  return kbps > 0 ? (uint64_t)audio_bytes * 8 / kbps : 0; // bits / kbit per second = ms
+}
+
+// Duration of a WAV from its fmt chunk byte rate; 0 if the fmt chunk is not within the header
+static uint32_t wavDuration(const uint8_t *header, size_t len, uint32_t audio_bytes){
+  size_t pos = wavChunk(header, len, "fmt ");
+  if(pos == 0 || pos + 20 > len){
+    return 0;
+  }
+  uint32_t byte_rate = le32(header + pos + 16);
+  return byte_rate > 0 ? (uint64_t)audio_bytes * 1000 / byte_rate : 0;
+}
+
+/*
+  Read a whole tone to identify it and checksum it. A file that is not a recognised codec is still recorded
+  (as TONE_CODEC_UNKNOWN) so that it is not rescanned on every refresh. Returns false if the file could not be read.
+*/
+static bool scanTone(tone_record &rec){
+  char path[sizeof(tone_dir) + TONE_INDEX_NAME_LEN + 1];
+  snprintf(path, sizeof(path), "%s/%s", tone_dir, rec.name);
+
+  uint8_t *buf = (uint8_t *)malloc(TONE_INDEX_READ_CHUNK);
+  if(buf == NULL){
+    return false;
+  }
+
+  audioLock();
+  File f = SD.open(path);
+  audioUnlock();
+  if(!f){
+    free(buf);
+    Sprint(F("Failed to open tone: ")); Sprintln(path);
+    return false;
+  }
+
+  uint32_t total = 0;
+  uint32_t crc = 0;
+  uint8_t frame[4];
+  bool have_frame = false;
+  while(total < rec.size){
+    // hold the SD card for one chunk at a time so the audio task can keep the codec fed
+    audioLock();
+    int n = f.read(buf, min((uint32_t)TONE_INDEX_READ_CHUNK, rec.size - total));
+    audioUnlock();
+    if(n <= 0){
+      break;
+    }
+
+    if(total == 0){
+      rec.codec = toneParseHeader(buf, n, &rec.data_offset, &rec.wav_length_field);
+      if(rec.data_offset > rec.size){
+        rec.codec = TONE_CODEC_UNKNOWN; // truncated, or a corrupt ID3 tag
+      }
+      if(rec.codec == TONE_CODEC_UNKNOWN){
+        break; // no need to checksum a file that will never be played
+      }
+      if(rec.codec == TONE_CODEC_WAV){
+        rec.duration_ms = wavDuration(buf, n, rec.size - rec.data_offset);
+      }
+    }
+    // the first mp3 frame follows the ID3 tag, which may be larger than a chunk
+    if(rec.codec == TONE_CODEC_MP3 && !have_frame && rec.data_offset >= total && rec.data_offset + 4 <= total + n){
+      memcpy(frame, buf + (rec.data_offset - total), 4);
+      have_frame = true;
+    }
+    crc = crc32_le(crc, buf, n);
+    total += n;
+  }
+
+  audioLock();
+  f.close();
+  audioUnlock();
+  free(buf);
+
+  if(rec.codec == TONE_CODEC_UNKNOWN){
+    Sprint(F("Not a playable tone: ")); Sprintln(path);
+    return true;
+  }
+  if(total != rec.size){
+    Sprint(F("Failed to read tone: ")); Sprintln(path);
+    return false;
+  }
+  if(have_frame){
+    rec.duration_ms = mp3Duration(frame, rec.size - rec.data_offset);
+  }
+  rec.checksum = crc;
+  Sprint(F("Indexed tone: ")); Sprint(rec.name); Sprint(F(" ")); Sprint(toneCodecName(rec.codec));
+  Sprint(F(" ")); Sprint(rec.duration_ms); Sprintln(F("ms"));
+  return true;
+}
+
+static bool loadIndex(){
+  tone_index_header header;
+
+  audioLock();
+  File f = SD.open(index_file);
+  bool valid = f && f.read((uint8_t *)&header, sizeof(header)) == sizeof(header)
+    && header.magic == TONE_INDEX_MAGIC && header.version == TONE_INDEX_VERSION && header.count <= TONE_INDEX_MAX_TONES
+    && f.read((uint8_t *)records, header.count * sizeof(tone_record)) == header.count * sizeof(tone_record);
+  if(f){
+    f.close();
+  }
+  audioUnlock();
+
+  for(size_t i = 0; valid && i < header.count; i++){
+    valid = memchr(records[i].name, '\0', TONE_INDEX_NAME_LEN) != NULL;
+  }
+  record_count = valid ? header.count : 0;
+  rebuildBuckets();
+  return valid;
+}
+
+static bool saveIndex(){
+  tone_index_header header;
+  header.magic = TONE_INDEX_MAGIC;
+  header.version = TONE_INDEX_VERSION;
+  header.count = record_count;
+
+  audioLock();
+  File f = SD.open(index_file, FILE_WRITE);
+  bool saved = f && f.write((const uint8_t *)&header, sizeof(header)) == sizeof(header)
+    && f.write((const uint8_t *)records, record_count * sizeof(tone_record)) == record_count * sizeof(tone_record);
+  if(f){
+    f.close();
+  }
+  audioUnlock();
+
+  if(!saved){
+    Sprint(F("Failed to save tone index: ")); Sprintln(index_file);
+  }
+  return saved;
+}
+
+bool initToneIndex(const char *dir, const char *index_path){
+  if(strlen(dir) >= sizeof(tone_dir) || strlen(index_path) >= sizeof(index_file)){
+    return false;
+  }
+  strcpy(tone_dir, dir);
+  strcpy(index_file, index_path);
+
+  if(loadIndex()){
+    Sprint(F("Tone index loaded: ")); Sprintln(record_count);
+  }
+  else{
+    Sprintln(F("No valid tone index; rebuilding"));
+  }
+  return toneIndexRefresh();
+}
+
+bool toneIndexRefresh(){
+  // list the directory first, without opening any tone, a batch of entries per lock
+  tone_record *found = new tone_record[TONE_INDEX_MAX_TONES];
+  size_t found_count = 0;
+  size_t listed = 0;
+
+  audioLock(); // SD card is shared with the audio task
+  File dir = SD.open(tone_dir);
+  if(!dir || !dir.isDirectory()){
+    audioUnlock();
+    delete[] found;
+    Sprint(F("Tone directory not found: ")); Sprintln(tone_dir);
+    return false;
+  }
+  while(true){
+    File entry = dir.openNextFile();
+    if(!entry){
+      break;
+    }
+    const char *name = entry.name();
+    // skip hidden files (such as the ._ files macOS leaves behind) and names too long to index
+    if(!entry.isDirectory() && name[0] != '.' && strlen(name) < TONE_INDEX_NAME_LEN){
+      if(found_count < TONE_INDEX_MAX_TONES){
+        tone_record &rec = found[found_count++];
+        memset(&rec, 0, sizeof(rec));
+        strcpy(rec.name, name);
+        rec.size = entry.size();
+        rec.mtime = entry.getLastWrite();
+      }
+      else{
+        Sprint(F("Too many tones; not indexed: ")); Sprintln(name);
+      }
+    }
+    entry.close();
+    if(++listed % TONE_INDEX_LIST_BATCH == 0){
+      // let the audio task at the bus between batches; only this task uses the open directory
+      audioUnlock();
+      audioLock();
+    }
+  }
+  dir.close();
+  audioUnlock();
+
+  // keep records of unchanged tones; only new or modified ones are read
+  bool changed = found_count != record_count;
+  size_t kept = 0;
+  for(size_t i = 0; i < found_count; i++){
+    const tone_record *old = findRecord(found[i].name);
+    if(old != NULL && old->size == found[i].size && old->mtime == found[i].mtime){
+      found[kept++] = *old;
+    }
+    else{
+      changed = true;
+      tone_record rec = found[i];
+      if(scanTone(rec)){
+        found[kept++] = rec;
+      }
+    }
+  }
+
+  memcpy(records, found, kept * sizeof(tone_record));
+  record_count = kept;
+  delete[] found;
+  rebuildBuckets();
+
+  Sprintln(F("Found tones:"));
+  for(size_t i = 0; i < record_count; i++){
+    if(records[i].codec != TONE_CODEC_UNKNOWN){
+      Sprint(F("\t")); Sprintln(records[i].name);
+    }
+  }
+
+  return changed ? saveIndex() : true;
+}
+
+const tone_record *toneIndexFind(const char *name){
+  if(name == NULL){
+    return NULL;
+  }
+  const tone_record *rec = findRecord(name);
+  return rec != NULL && rec->codec != TONE_CODEC_UNKNOWN ? rec : NULL;
+}
+
+size_t toneIndexCount(){
+  return record_count;
+}
+
+const tone_record *toneIndexAt(size_t i){
+  return i < record_count ? &records[i] : NULL;
+}
@@ -0,0 +1,71 @@
+#ifndef TONE_INDEX_H
+#define TONE_INDEX_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "rom/crc.h"
+#include "log.h"
+
+/*
+  Keeps a compact binary index of the tones directory on the SD card, so that tones can be listed and validated without
+  opening every file, and playback can seek straight to the audio data.
+
+  Each record holds the tone's name, size, last write time, codec, the offset of its audio data past the ID3/RIFF headers,
+  an estimated duration and a CRC32 of the whole file. At boot the index file is loaded and compared with the directory
+  listing; only tones that are new or whose size or write time have changed are opened and scanned, and the index file
+  is only rewritten if something changed. FAT keeps no reliable modification stamp on the directory itself, so the
+  listing is still read, but file contents are not.
+
+  Lookups by name are hash probes (toneIndexFind()); a name that is not in the index, or that was rejected because its
+  codec is not recognised, is refused before any SD card access.
+
+  The index is only read and refreshed from one task, normally loop().
+*/
+
+#define TONE_INDEX_MAX_TONES 64
+#define TONE_INDEX_NAME_LEN 32        // tone file name, without directory
+#define TONE_INDEX_BUCKETS 128        // hash table slots; power of two, at least twice TONE_INDEX_MAX_TONES
+#define TONE_INDEX_READ_CHUNK 4096    // bytes read from SD per lock while checksumming; lets the audio task feed the codec in between
+#define TONE_INDEX_LIST_BATCH 8       // directory entries listed per lock; a directory walk is many small reads
+#define TONE_INDEX_HEADER_PEEK 512    // bytes read from the start of a tone to identify it
+#define TONE_INDEX_MAGIC 0x58444954   // "TIDX"
+#define TONE_INDEX_VERSION 1
+
+// *********************************************************************************************************************
+// *** Data Types ***
+enum tone_codec : uint8_t { TONE_CODEC_UNKNOWN, TONE_CODEC_MP3, TONE_CODEC_WAV, TONE_CODEC_OGG, TONE_CODEC_AAC, TONE_CODEC_FLAC, TONE_CODEC_MIDI };
+
+// Stored as-is in the index file
+struct tone_record{
+  char name[TONE_INDEX_NAME_LEN]; // file name within the tones directory
+  uint32_t size;                  // bytes
+  uint32_t mtime;                 // last write time reported by the SD card; with size, detects a replaced file
+  uint32_t data_offset;           // first byte of audio data past the ID3 tag or RIFF headers
+  int32_t wav_length_field;       // offset of the WAV data chunk length, or -1
+  uint32_t duration_ms;           // estimated; 0 if unknown for this codec
+  uint32_t checksum;              // CRC32 of the whole file
+  uint8_t codec;                  // tone_codec
+  uint8_t reserved[3];
+};
+
+struct tone_index_header{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;                 // records following the header
+};
+
+// *********************************************************************************************************************
+// *** Must Implement ***
+void audioLock();                 // provided by audio-player; guards SD card access
+void audioUnlock();
+
+// Provided in library
+bool initToneIndex(const char *dir, const char *index_path);   // load index and bring it up to date; call after SD.begin() and initAudioPlayer()
+bool toneIndexRefresh();                                        // rescan new or changed tones; rewrites the index file only if anything changed
+const tone_record *toneIndexFind(const char *name);             // NULL if name is not a playable tone
+size_t toneIndexCount();
+const tone_record *toneIndexAt(size_t i);                       // directory order; includes rejected files (TONE_CODEC_UNKNOWN)
+tone_codec toneParseHeader(const uint8_t *header, size_t len, uint32_t *data_offset, int32_t *wav_length_field);   // identify tone from its first bytes
+const char *toneCodecName(uint8_t codec);
+
+#endif
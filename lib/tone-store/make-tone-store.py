@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Build the flash tone store image (see tone-store.h) from a few tone files, and print the esptool command that writes it
+to the "tones" partition.
+
+    lib/tone-store/make-tone-store.py content/tones/doorbell.wav alarm.mp3 -o tones.bin
+    esptool.py --chip esp32s2 --port /dev/ttyACM0 write_flash 0x310000 tones.bin
+
+Tones keep their file names, so a stored "doorbell.wav" is played for the siren tone "doorbell.wav" whether or not the
+SD card also holds it. Prefer short mp3 tones: the partition is 960KB and a second of CD quality WAV is 176KB.
+"""
+import argparse
+import csv
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = 0x52545354  # "TSTR"
+VERSION = 1
+MAX_TONES = 8
+NAME_LEN = 32
+HEADER = struct.Struct("<IHHII")          # magic, version, count, image_size, checksum
+ENTRY = struct.Struct("<%dsIII" % NAME_LEN)  # name, offset, size, checksum
+ALIGN = 4
+
+
+def partition(table, label):
+    """Offset and size of the partition with this label in a partitions.csv"""
+    with open(table) as f:
+        for row in csv.reader(line for line in f if not line.lstrip().startswith("#")):
+            row = [c.strip() for c in row]
+            if len(row) >= 5 and row[0] == label:
+                return int(row[3], 0), int(row[4], 0)
+    raise SystemExit("%s: no partition labelled %s" % (table, label))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the flash tone store image")
+    parser.add_argument("tones", nargs="+", help="tone files; stored under their file names")
+    parser.add_argument("-o", "--output", default="tones.bin")
+    parser.add_argument("--partitions", default=os.path.join(os.path.dirname(__file__), "..", "..", "partitions.csv"))
+    parser.add_argument("--label", default="tones")
+    args = parser.parse_args()
+
+    offset, capacity = partition(args.partitions, args.label)
+    if len(args.tones) > MAX_TONES:
+        raise SystemExit("at most %d tones" % MAX_TONES)
+
+    entries = []
+    data = b""
+    pos = HEADER.size + ENTRY.size * len(args.tones)
+    for path in args.tones:
+        name = os.path.basename(path)
+        if len(name.encode()) >= NAME_LEN or name.startswith("."):
+            raise SystemExit("%s: name must be under %d characters" % (name, NAME_LEN))
+        if name in (e[0] for e in entries):
+            raise SystemExit("%s: stored twice" % name)
+        with open(path, "rb") as f:
+            tone = f.read()
+        pad = -pos % ALIGN
+        data += b"\xff" * pad
+        pos += pad
+        entries.append((name, pos, len(tone), zlib.crc32(tone)))
+        data += tone
+        pos += len(tone)
+
+    table = b"".join(ENTRY.pack(n.encode(), o, s, c) for n, o, s, c in entries)
+    image = HEADER.pack(MAGIC, VERSION, len(entries), pos, zlib.crc32(table)) + table + data
+    if len(image) > capacity:
+        raise SystemExit("image is %d bytes; the %s partition holds %d" % (len(image), args.label, capacity))
+
+    with open(args.output, "wb") as f:
+        f.write(image)
+    for n, o, s, c in entries:
+        print("  %-32s %8d bytes" % (n, s))
+    print("%s: %d of %d bytes (%d%%)" % (args.output, len(image), capacity, 100 * len(image) // capacity))
+    print("esptool.py --chip esp32s2 --port /dev/ttyACM0 write_flash 0x%x %s" % (offset, args.output))
+
+
+if __name__ == "__main__":
+    main()
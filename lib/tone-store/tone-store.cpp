@@ -0,0 +1,104 @@
+#include "tone-store.h"
+
+static const uint8_t *image = NULL;           // mapped image; NULL if the store is empty
+static const tone_store_entry *entries = NULL;
+static size_t entry_count = 0;
+static size_t image_size = 0;
+static size_t capacity = 0;
+static esp_partition_mmap_handle_t mapping;
+
+static const char *baseName(const char *path){
+  const char *slash = strrchr(path, '/');
+  return slash != NULL ? slash + 1 : path;
+}
+
+/*
+  Check every entry lies within the image, is named, and matches its checksum. A tone is only ever played from the
+  store if the whole image is intact, so a half written image cannot send garbage to the codec.
+*/
+static bool verifyImage(const tone_store_header &header){
+  const tone_store_entry *table = (const tone_store_entry *)(image + sizeof(tone_store_header));
+  if(crc32_le(0, (const uint8_t *)table, header.count * sizeof(tone_store_entry)) != header.checksum){
+    Sprintln(F("Tone store table corrupt"));
+    return false;
+  }
+  for(size_t i = 0; i < header.count; i++){
+    const tone_store_entry &e = table[i];
+    if(memchr(e.name, '\0', TONE_STORE_NAME_LEN) == NULL || e.name[0] == '\0'
+      || e.offset > header.image_size || e.size > header.image_size - e.offset){
+      Sprintln(F("Tone store entry invalid"));
+      return false;
+    }
+    if(crc32_le(0, image + e.offset, e.size) != e.checksum){
+      Sprint(F("Tone store checksum mismatch: ")); Sprintln(e.name);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool initToneStore(const char *label){
+  const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)TONE_STORE_SUBTYPE, label);
+  if(part == NULL){
+    Sprintln(F("No tone store partition"));
+    return false;
+  }
+  capacity = part->size;
+
+  // read the header first so that only the part of the partition in use is mapped
+  tone_store_header header;
+  if(esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK || header.magic != TONE_STORE_MAGIC
+    || header.version != TONE_STORE_VERSION || header.count > TONE_STORE_MAX_TONES
+    || header.image_size > part->size || header.image_size < sizeof(header) + header.count * sizeof(tone_store_entry)){
+    Sprintln(F("No tone store image"));
+    return false;
+  }
+
+  const void *mapped = NULL;
+  if(esp_partition_mmap(part, 0, header.image_size, ESP_PARTITION_MMAP_DATA, &mapped, &mapping) != ESP_OK){
+    Sprintln(F("Failed to map tone store"));
+    return false;
+  }
+  image = (const uint8_t *)mapped;
+  if(!verifyImage(header)){
+    esp_partition_munmap(mapping);
+    image = NULL;
+    return false;
+  }
+  entries = (const tone_store_entry *)(image + sizeof(tone_store_header));
+  entry_count = header.count;
+  image_size = header.image_size;
+  Sprint(F("Tone store tones: ")); Sprintln(entry_count);
+  return true;
+}
+
+bool toneStoreFind(const char *path, const uint8_t **data, size_t *size){
+  if(path == NULL){
+    return false;
+  }
+  const char *name = baseName(path);
+  for(size_t i = 0; i < entry_count; i++){
+    if(strcmp(entries[i].name, name) == 0){
+      *data = image + entries[i].offset;
+      *size = entries[i].size;
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t toneStoreCount(){
+  return entry_count;
+}
+
+const char *toneStoreName(size_t i){
+  return i < entry_count ? entries[i].name : NULL;
+}
+
+size_t toneStoreUsed(){
+  return image_size;
+}
+
+size_t toneStoreCapacity(){
+  return capacity;
+}
@@ -0,0 +1,59 @@
+#ifndef TONE_STORE_H
+#define TONE_STORE_H
+
+#include <Arduino.h>
+#include "esp_partition.h"
+#include "rom/crc.h"
+#include "log.h"
+
+/*
+  A small set of critical tones (doorbell, alarm) kept in a dedicated partition of the internal flash, so they play
+  immediately and still play when the SD card is missing, slow or busy.
+
+  The partition holds an image built by make-tone-store.py: a header, a table of entries (name, offset, size, CRC32) and
+  the tone files themselves. At boot the image is checked and memory mapped with esp_partition_mmap(); from then on a tone
+  is a pointer into flash, read in place through the flash cache, with no copy held in RAM or PSRAM and no SPI bus
+  transaction shared with the codec. A tone is looked up by its file name alone, so "/tones/doorbell.wav" finds the
+  stored "doorbell.wav" and playlists need not know where a tone is kept.
+
+  The image is written with esptool at the partition's offset (see partitions.csv and the README), independently of the
+  firmware. A missing, blank or corrupt image simply leaves the store empty.
+
+  Lookups are safe from any task once initToneStore() has returned.
+*/
+
+#define TONE_STORE_PARTITION "tones"  // label in partitions.csv
+#define TONE_STORE_SUBTYPE 0x40       // custom data partition subtype, as in partitions.csv
+#define TONE_STORE_MAX_TONES 8
+#define TONE_STORE_NAME_LEN 32        // tone file name, without directory; as TONE_INDEX_NAME_LEN
+#define TONE_STORE_MAGIC 0x52545354   // "TSTR"
+#define TONE_STORE_VERSION 1
+
+// *********************************************************************************************************************
+// *** Data Types ***
+
+// Stored as-is at the start of the partition, followed by count entries; little endian
+struct tone_store_header{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;                 // entries following the header
+  uint32_t image_size;            // header, entries and tone data; what is mapped
+  uint32_t checksum;              // CRC32 of the entries
+};
+
+struct tone_store_entry{
+  char name[TONE_STORE_NAME_LEN]; // file name, as the tone is named on the SD card
+  uint32_t offset;                // from the start of the image
+  uint32_t size;                  // bytes
+  uint32_t checksum;              // CRC32 of the whole file
+};
+
+// Provided in library
+bool initToneStore(const char *label = TONE_STORE_PARTITION); // verify and map the image; false if there is none (the store is then empty)
+bool toneStoreFind(const char *path, const uint8_t **data, size_t *size); // by file name, ignoring any directory; data stays valid
+size_t toneStoreCount();
+const char *toneStoreName(size_t i);  // name of the i'th stored tone
+size_t toneStoreUsed();               // bytes of the partition in use
+size_t toneStoreCapacity();           // size of the partition; 0 if there is none
+
+#endif
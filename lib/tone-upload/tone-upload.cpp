@@ -0,0 +1,421 @@
+#include "tone-upload.h"
+
+enum upload_job_kind : uint8_t { UPLOAD_JOB_OPEN, UPLOAD_JOB_WRITE, UPLOAD_JOB_VERIFY, UPLOAD_JOB_ABORT };
+
+struct upload_job{
+  upload_job_kind kind;
+  int8_t slot;                    // write: buffer holding the chunk
+  uint16_t len;                   // write: bytes in the buffer
+  uint32_t generation;            // open: identifies the upload in the writer's results
+  tone_upload_kind upload_kind;   // open: which directory
+  uint32_t crc;                   // open: CRC32 of the whole tone
+  uint32_t size;                  // open
+  uint32_t chunk;                 // open
+};
+
+static char tone_dir[TONE_INDEX_NAME_LEN * 2] = "";
+static char graphic_dir[sizeof(tone_dir)] = "";
+static tone_upload_graphics graphic_checks = {};  // name and header checks; the directory is copied to graphic_dir
+static uint8_t *slots[TONE_UPLOAD_SLOTS];
+static QueueHandle_t jobs = NULL;         // upload_job, for the writer
+static QueueHandle_t free_slots = NULL;   // int8_t, buffers the writer has finished with
+
+// owned by the caller of toneUploadBegin()/toneUploadChunk() (loop)
+static tone_upload_status status;
+static uint32_t upload_crc = 0;
+static uint32_t generation = 0;
+static unsigned long started_ms = 0;
+static uint32_t reported_written = 0;
+static bool report_due = false;
+
+// owned by the writer task; published to loop through the volatile results below
+static File part;
+static char part_path[sizeof(tone_dir) + TONE_INDEX_NAME_LEN];
+static uint32_t part_crc = 0;
+static uint32_t part_size = 0;
+static uint32_t unflushed = 0;            // chunks written since the last flush
+
+static volatile uint32_t writer_generation = 0;   // upload the results below are for; set once it has been opened
+static volatile uint32_t writer_written = 0;      // bytes of it on the card
+static volatile bool writer_verified = false;
+static const char *volatile writer_error = NULL;
+
+static const char *uploadDir(tone_upload_kind kind){
+  return kind == TONE_UPLOAD_GRAPHIC ? graphic_dir : tone_dir;
+}
+
+static void partPath(char *path, size_t len, tone_upload_kind kind, uint32_t crc){
+  snprintf(path, len, "%s/" TONE_UPLOAD_PART_PREFIX "%08lx", uploadDir(kind), (unsigned long)crc);
+}
+
+// *** Writer task ***
+
+static void closePart(bool remove){
+  audioLock();
+  if(part){
+    part.close();
+  }
+  if(remove && part_path[0] != '\0'){
+    SD.remove(part_path);
+  }
+  audioUnlock();
+  if(remove){
+    part_path[0] = '\0';
+  }
+}
+
+static void failPart(const char *error){
+  Sprint(F("Tone upload failed: ")); Sprintln(error);
+  closePart(false);
+  writer_error = error;
+}
+
+/*
+  Open the file for an upload, keeping whatever a previous attempt at the same upload left on the card as long as it
+  ends on a chunk boundary (it was flushed after a whole chunk); otherwise start it again.
+*/
+static void openPart(const upload_job &job){
+  writer_written = 0;
+  writer_verified = false;
+  writer_error = NULL;
+  unflushed = 0;
+
+  char path[sizeof(part_path)];
+  partPath(path, sizeof(path), job.upload_kind, job.crc);
+  if(strcmp(path, part_path) != 0){
+    closePart(true); // abandon the previous upload
+    strcpy(part_path, path);
+  }
+  part_crc = job.crc;
+  part_size = job.size;
+
+  audioLock();
+  if(part){
+    part.close();
+  }
+  uint32_t kept = 0;
+  if(SD.exists(part_path)){
+    part = SD.open(part_path, FILE_APPEND);
+    kept = part ? part.size() : 0;
+    if(kept % job.chunk != 0 || kept > job.size){
+      part.close();
+      kept = 0;
+    }
+  }
+  if(kept == 0){
+    part = SD.open(part_path, FILE_WRITE);
+  }
+  audioUnlock();
+
+  writer_written = kept;
+  if(!part){
+    writer_error = "cannot create file";
+  }
+  else if(kept > 0){
+    Sprint(F("Tone upload resumed at ")); Sprintln(kept);
+  }
+  __atomic_thread_fence(__ATOMIC_RELEASE); // results are visible before the generation that validates them
+  writer_generation = job.generation;
+}
+
+static void writeChunk(const upload_job &job){
+  if(!part || writer_error != NULL){
+    return; // failed or abandoned; the chunk is discarded
+  }
+  // one chunk per claim, so the audio task gets the bus between any two
+  audioLock();
+  size_t n = part.write(slots[job.slot], job.len);
+  audioUnlock();
+  if(n != job.len){
+    failPart("write failed (card full?)");
+    return;
+  }
+  if(++unflushed >= TONE_UPLOAD_FLUSH_CHUNKS){
+    audioLock();
+    part.flush();
+    audioUnlock();
+    unflushed = 0;
+  }
+  writer_written = writer_written + n;
+}
+
+// Read the whole file back and check it against the upload's CRC before it can be installed
+static void verifyPart(){
+  if(!part || writer_error != NULL){
+    return;
+  }
+  uint8_t *buf = (uint8_t *)malloc(TONE_INDEX_READ_CHUNK);
+  if(buf == NULL){
+    failPart("out of memory");
+    return;
+  }
+  audioLock();
+  part.close();
+  File f = SD.open(part_path);
+  audioUnlock();
+
+  uint32_t total = 0;
+  uint32_t crc = 0;
+  while(f && total < part_size){
+    audioLock();
+    int n = f.read(buf, min((uint32_t)TONE_INDEX_READ_CHUNK, part_size - total));
+    audioUnlock();
+    if(n <= 0){
+      break;
+    }
+    crc = crc32_le(crc, buf, n);
+    total += n;
+  }
+  audioLock();
+  if(f){
+    f.close();
+  }
+  audioUnlock();
+  free(buf);
+
+  if(total != part_size || crc != part_crc){
+    failPart("checksum mismatch");
+    closePart(true); // start from scratch if it is sent again
+    return;
+  }
+  writer_verified = true;
+}
+
+static void writerTask(void *param){
+  upload_job job;
+  while(true){
+    if(xQueueReceive(jobs, &job, portMAX_DELAY) != pdTRUE){
+      continue;
+    }
+    switch(job.kind){
+      case UPLOAD_JOB_OPEN:
+        openPart(job);
+        break;
+      case UPLOAD_JOB_WRITE:
+        writeChunk(job);
+        xQueueSend(free_slots, &job.slot, 0);
+        break;
+      case UPLOAD_JOB_VERIFY:
+        verifyPart();
+        break;
+      case UPLOAD_JOB_ABORT:
+        closePart(true);
+        break;
+    }
+  }
+}
+
+// *** Caller (loop) ***
+
+bool initToneUpload(const char *dir, const tone_upload_graphics *graphics){
+  if(strlen(dir) >= sizeof(tone_dir) || (graphics != NULL && (graphics->dir == NULL || strlen(graphics->dir) >= sizeof(graphic_dir)
+    || graphics->check_name == NULL || graphics->check_header == NULL))){
+    return false;
+  }
+  strcpy(tone_dir, dir);
+  if(graphics != NULL){
+    strcpy(graphic_dir, graphics->dir);
+    graphic_checks = *graphics;
+  }
+  free_slots = xQueueCreate(TONE_UPLOAD_SLOTS, sizeof(int8_t));
+  jobs = xQueueCreate(TONE_UPLOAD_SLOTS + 2, sizeof(upload_job)); // every chunk, plus an open and a verify
+  if(free_slots == NULL || jobs == NULL){
+    return false;
+  }
+  for(int8_t i = 0; i < TONE_UPLOAD_SLOTS; i++){
+    slots[i] = (uint8_t *)(psramFound() ? ps_malloc(TONE_UPLOAD_CHUNK) : malloc(TONE_UPLOAD_CHUNK));
+    if(slots[i] == NULL){
+      return false;
+    }
+    xQueueSend(free_slots, &i, 0);
+  }
+  return xTaskCreate(writerTask, "upload", TONE_UPLOAD_TASK_STACK, NULL, TONE_UPLOAD_TASK_PRIORITY, NULL) == pdPASS;
+}
+
+static void fail(const char *error){
+  Sprint(F("Tone upload failed: ")); Sprintln(error);
+  status.state = TONE_UPLOAD_FAILED;
+  status.error = error;
+  report_due = true;
+}
+
+bool toneUploadBegin(const char *name, uint32_t size, uint32_t crc, uint32_t chunk, tone_upload_kind kind){
+  if(jobs == NULL){
+    return false;
+  }
+  bool same = crc == upload_crc && size == status.size && chunk == status.chunk && kind == status.kind && strcmp(name, status.name) == 0;
+  report_due = true; // always answer, so a resuming sender learns where to continue
+  if(same && status.state != TONE_UPLOAD_IDLE && status.state != TONE_UPLOAD_FAILED && status.state != TONE_UPLOAD_COMPLETE){
+    return true; // still in progress; the sender continues from next_seq
+  }
+
+  status = tone_upload_status();
+  snprintf(status.name, sizeof(status.name), "%s", name);
+  status.size = size;
+  status.chunk = chunk;
+  status.kind = kind;
+  upload_crc = crc;
+  reported_written = 0;
+  started_ms = millis();
+
+  if(name[0] == '\0' || name[0] == '.' || strchr(name, '/') != NULL || strlen(name) >= TONE_INDEX_NAME_LEN){
+    fail("invalid name");
+    return false;
+  }
+  if(size == 0 || chunk == 0 || chunk > TONE_UPLOAD_CHUNK){
+    fail("invalid size");
+    return false;
+  }
+  if(kind == TONE_UPLOAD_GRAPHIC && (graphic_dir[0] == '\0' || !graphic_checks.check_name(name))){
+    fail(graphic_dir[0] == '\0' ? "graphics not supported" : "invalid graphic name");
+    return false;
+  }
+
+  upload_job job = {};
+  job.kind = UPLOAD_JOB_OPEN;
+  job.generation = ++generation;
+  job.crc = crc;
+  job.size = size;
+  job.chunk = chunk;
+  job.upload_kind = kind;
+  if(xQueueSend(jobs, &job, 0) != pdPASS){
+    fail("busy");
+    return false;
+  }
+  status.state = TONE_UPLOAD_OPENING;
+  Sprint(kind == TONE_UPLOAD_GRAPHIC ? F("Graphic upload: ") : F("Tone upload: ")); Sprint(name); Sprint(F(" ")); Sprintln(size);
+  return true;
+}
+
+bool toneUploadChunk(const uint8_t *frame, size_t len){
+  tone_upload_frame header;
+  if(len < sizeof(header) || status.state != TONE_UPLOAD_RECEIVING){
+    return false;
+  }
+  memcpy(&header, frame, sizeof(header));
+  const uint8_t *data = frame + sizeof(header);
+  uint32_t data_len = len - sizeof(header);
+  uint32_t offset = header.seq * status.chunk;
+
+  if(header.upload_id != upload_crc || header.seq != status.next_seq
+    || data_len != min(status.chunk, status.size - offset) || crc32_le(0, data, data_len) != header.checksum){
+    // resent from next_seq once the sender hears of it
+    status.dropped++;
+    report_due = true;
+    return false;
+  }
+  if(header.seq == 0){
+    uint32_t data_offset;
+    int32_t wav_length_field;
+    bool valid = status.kind == TONE_UPLOAD_GRAPHIC ? graphic_checks.check_header(data, data_len)
+      : toneParseHeader(data, data_len, &data_offset, &wav_length_field) != TONE_CODEC_UNKNOWN;
+    if(!valid){
+      upload_job abort = {};
+      abort.kind = UPLOAD_JOB_ABORT;
+      xQueueSend(jobs, &abort, 0);
+      fail(status.kind == TONE_UPLOAD_GRAPHIC ? "not a graphic" : "not a playable tone");
+      return false;
+    }
+  }
+
+  int8_t slot;
+  if(xQueueReceive(free_slots, &slot, 0) != pdTRUE){
+    status.dropped++; // the writer is behind; more chunks in flight than there are buffers
+    report_due = true;
+    return false;
+  }
+  memcpy(slots[slot], data, data_len);
+  upload_job job = {};
+  job.kind = UPLOAD_JOB_WRITE;
+  job.slot = slot;
+  job.len = data_len;
+  xQueueSend(jobs, &job, 0); // cannot be full: one entry per buffer, plus the open and verify
+  status.next_seq++;
+
+  if(offset + data_len >= status.size){
+    job.kind = UPLOAD_JOB_VERIFY;
+    xQueueSend(jobs, &job, 0);
+    status.state = TONE_UPLOAD_VERIFYING;
+    report_due = true;
+  }
+  return true;
+}
+
+bool toneUploadPoll(tone_upload_status &out){
+  bool current = writer_generation == generation;
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+  if(current && (status.state == TONE_UPLOAD_OPENING || status.state == TONE_UPLOAD_RECEIVING || status.state == TONE_UPLOAD_VERIFYING)){
+    status.written = writer_written;
+    if(writer_error != NULL){
+      fail(writer_error);
+    }
+    else if(status.state == TONE_UPLOAD_OPENING){
+      status.next_seq = status.written / status.chunk;
+      status.state = TONE_UPLOAD_RECEIVING;
+      reported_written = status.written;
+      report_due = true;
+      if(status.written == status.size){ // all of it was already on the card
+        upload_job job = {};
+        job.kind = UPLOAD_JOB_VERIFY;
+        xQueueSend(jobs, &job, 0);
+        status.state = TONE_UPLOAD_VERIFYING;
+      }
+    }
+    else if(status.state == TONE_UPLOAD_VERIFYING && writer_verified){
+      status.state = TONE_UPLOAD_READY;
+      report_due = true;
+    }
+    else if(status.written - reported_written >= TONE_UPLOAD_STATUS_CHUNKS * status.chunk){
+      reported_written = status.written;
+      report_due = true;
+    }
+  }
+  if(status.state == TONE_UPLOAD_OPENING || status.state == TONE_UPLOAD_RECEIVING || status.state == TONE_UPLOAD_VERIFYING){
+    status.elapsed_ms = millis() - started_ms;
+  }
+
+  out = status;
+  bool report = report_due;
+  report_due = false;
+  return report;
+}
+
+bool toneUploadInstall(){
+  if(status.state != TONE_UPLOAD_READY){
+    return false;
+  }
+  char path[sizeof(tone_dir) + TONE_INDEX_NAME_LEN + 1];
+  snprintf(path, sizeof(path), "%s/%s", uploadDir(status.kind), status.name);
+  char uploaded[sizeof(part_path)];
+  partPath(uploaded, sizeof(uploaded), status.kind, upload_crc);
+
+  // the writer is idle until the next upload begins
+  audioLock();
+  if(SD.exists(path)){
+    SD.remove(path); // replacing a tone or graphic
+  }
+  bool renamed = SD.rename(uploaded, path);
+  audioUnlock();
+  if(!renamed){
+    fail("rename failed");
+    return false;
+  }
+  status.state = TONE_UPLOAD_COMPLETE;
+  report_due = true;
+  Sprint(F("Uploaded: ")); Sprint(path); Sprint(F(" in ")); Sprint(status.elapsed_ms); Sprintln(F("ms"));
+  return true;
+}
+
+const char *toneUploadStateName(tone_upload_state state){
+  switch(state){
+    case TONE_UPLOAD_IDLE: return "idle";
+    case TONE_UPLOAD_OPENING: return "opening";
+    case TONE_UPLOAD_RECEIVING: return "receiving";
+    case TONE_UPLOAD_VERIFYING: return "verifying";
+    case TONE_UPLOAD_READY: return "ready";
+    case TONE_UPLOAD_COMPLETE: return "complete";
+    case TONE_UPLOAD_FAILED: return "failed";
+  }
+  return "unknown";
+}
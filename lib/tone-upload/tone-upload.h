@@ -0,0 +1,103 @@
+#ifndef TONE_UPLOAD_H
+#define TONE_UPLOAD_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "rom/crc.h"
+#include "tone-index.h"
+#include "log.h"
+
+/*
+  Receives a tone in numbered chunks (over MQTT, see the README) and writes it to the tones directory on the SD card, so
+  that tones can be added without pulling the card.
+
+  An upload starts with toneUploadBegin(): the tone's name, size and CRC32, and the chunk size the sender will use. Each
+  chunk then arrives as a frame of a tone_upload_frame header (the upload's CRC32 as its id, the chunk's sequence number
+  and the chunk's own CRC32) followed by the data. Frames are checked where they arrive, in toneUploadChunk(): a frame
+  for another upload, out of sequence or failing its checksum is dropped, and the sender resends from next_seq, which is
+  reported in every status. Accepted chunks are copied into one of TONE_UPLOAD_SLOTS buffers and written by a writer task
+  that runs at loopTask's priority, below the audio task, one chunk per SD card claim; so a chunk is written whenever the
+  audio task does not need the bus and the codec is never kept waiting longer than one write. When no buffer is free
+  the chunk is dropped like any other, which is the sender's cue to keep fewer chunks in flight.
+
+  The tone is written to a hidden file named after its CRC (which the tone index skips) and flushed every
+  TONE_UPLOAD_FLUSH_CHUNKS, so after a dropped broker connection or a reboot the sender begins the same upload again and
+  resumes at the first chunk not yet on the card. Once the last chunk is written the whole file is read back and checked
+  against the upload's CRC. The main program then moves it into place with toneUploadInstall() while nothing is
+  playing, and refreshes the tone index.
+
+  Graphics for the display are uploaded the same way, begun with kind TONE_UPLOAD_GRAPHIC, when initToneUpload() is
+  given a tone_upload_graphics: its directory instead of the tones directory, and its checks of the name and of the
+  first chunk instead of a tone's. The main program passes graphic-store.h's; this library does not depend on it.
+
+  Begin, chunk, poll and install are called from one task, normally loop() (the MQTT callback runs there).
+*/
+
+#define TONE_UPLOAD_CHUNK 4096        // largest chunk; the MQTT client's read buffer must hold a frame of this size
+#define TONE_UPLOAD_SLOTS 8           // chunks buffered between the MQTT callback and the writer (PSRAM if present); the sender's window
+#define TONE_UPLOAD_FLUSH_CHUNKS 16   // chunks written between flushes; what may need resending after a reboot
+#define TONE_UPLOAD_STATUS_CHUNKS 4   // chunks written between two progress reports to the sender
+#define TONE_UPLOAD_TASK_PRIORITY 1   // as loopTask; below the audio task, so never ahead of feeding the codec
+#define TONE_UPLOAD_TASK_STACK 4096   // bytes
+#define TONE_UPLOAD_PART_PREFIX ".upload-"  // partially uploaded file in its directory; followed by the CRC in hex
+
+// *********************************************************************************************************************
+// *** Data Types ***
+enum tone_upload_kind : uint8_t {
+  TONE_UPLOAD_TONE,               // to the tones directory
+  TONE_UPLOAD_GRAPHIC             // a graphic blob, to the graphics directory
+};
+
+enum tone_upload_state : uint8_t {
+  TONE_UPLOAD_IDLE,
+  TONE_UPLOAD_OPENING,            // writer is opening, or finding how much of a previous attempt is on the card
+  TONE_UPLOAD_RECEIVING,
+  TONE_UPLOAD_VERIFYING,          // all chunks received; being written and checked
+  TONE_UPLOAD_READY,              // verified; waiting for toneUploadInstall()
+  TONE_UPLOAD_COMPLETE,
+  TONE_UPLOAD_FAILED
+};
+
+// Precedes every chunk; little endian
+struct tone_upload_frame{
+  uint32_t upload_id;             // CRC32 of the whole tone, as given to toneUploadBegin()
+  uint32_t seq;                   // chunk number, from 0
+  uint32_t checksum;              // CRC32 of the chunk's data
+};
+
+struct tone_upload_graphics{
+  const char *dir;                                          // where they are written
+  bool (*check_name)(const char *name);                     // e.g. graphicStoreCheckName()
+  bool (*check_header)(const uint8_t *data, size_t len);    // start of the first chunk; e.g. graphicStoreCheckHeader()
+};
+
+struct tone_upload_status{
+  tone_upload_state state = TONE_UPLOAD_IDLE;
+  tone_upload_kind kind = TONE_UPLOAD_TONE;
+  char name[TONE_INDEX_NAME_LEN] = "";
+  uint32_t size = 0;              // bytes
+  uint32_t chunk = 0;             // bytes per chunk
+  uint32_t next_seq = 0;          // first chunk not yet accepted; where the sender continues
+  uint32_t written = 0;           // bytes on the card
+  uint32_t dropped = 0;           // frames dropped (out of sequence, bad checksum, no free buffer)
+  uint32_t elapsed_ms = 0;        // from begin until verified
+  const char *error = "";         // why it failed
+};
+
+// *********************************************************************************************************************
+// *** Must Implement ***
+void audioLock();                 // provided by audio-player; guards SD card access
+void audioUnlock();
+
+// Provided in library
+bool initToneUpload(const char *dir, const tone_upload_graphics *graphics = NULL);  // start the writer task; after initAudioPlayer(). Graphics only if given
+bool toneUploadBegin(const char *name, uint32_t size, uint32_t crc, uint32_t chunk, tone_upload_kind kind = TONE_UPLOAD_TONE);  // start or resume; false if refused (see status)
+bool toneUploadChunk(const uint8_t *frame, size_t len);       // a tone_upload_frame and its data; false if dropped
+bool toneUploadPoll(tone_upload_status &status);              // current status; true if the sender should be told now
+bool toneUploadInstall();                                     // move a verified upload into place; call while nothing is playing
+const char *toneUploadStateName(tone_upload_state state);
+
+#endif
@@ -15,13 +15,46 @@
     state: ON
     volume_level: 0.0..1.0,
     tone: [alarm.mp3|doorbell.wav],  FILE EXPECTED TO BE FOUND IN DIRECTORY TONE_DIR ON SDCARD
-    duration: 0..n   NOT SUPPORTED
+    duration: 0..n   seconds; tone is looped until duration elapses (0 or absent plays tone once)
+    priority: 0..255 (optional, default 1)
+    fade_ms: 0..n    (optional) fade in, and fade out at the end of the duration
   }  
   OR
+  {
+    state: ON
+    volume_level: 0.0..1.0,
+    sequence: [ { tone: chime.wav, repeat: 1, gap_ms: 500 }, { tone: announce.mp3 }, { tone: chime.wav } ]
+    duration: 0..n   (optional)
+    priority: 0..255 (optional, default 1)
+    fade_ms: 0..n    (optional)
+  }
+  OR
+  {
+    state: ON
+    volume_level: 0.0..1.0,
+    url: http://192.168.1.10:8000/announce.mp3   streamed over HTTP in place of a tone
+    duration: 0..n   (optional)
+    priority: 0..255 (optional, default 1)
+    fade_ms: 0..n    (optional)
+  }
+  OR
+  {
+    state: ON
+    volume_level: 0.0..1.0,
+    midi: [ [14,76,100,500], [14,72,100,500], [14,67,100,1000] ]   [program, note, velocity, duration_ms] played by the codec's synth
+    priority: 0..255 (optional, default 1)
+  }
+  OR
   {
     state: OFF
+    fade_ms: 0..n    (optional) fade out before stopping
   }  
 
+  A command with a higher priority than the one playing interrupts it (e.g. fire alarm over doorbell); a lower priority is dropped.
+  An equal priority command within AUDIO_COALESCE_WINDOW_MS of the one playing is coalesced into it instead of restarting playback;
+  only its volume is applied (ramped over its fade_ms).
+  A dropped or coalesced command is not reflected to the state topic. OFF always stops playback.
+
 *** Text Integration ***
 
 Display message on command. 
@@ -40,13 +73,18 @@ The first is preferrable since it more clearly reflects the command back to stat
 The second will actually result in the command and state topics begin deleted in the broker.
 
 Supported Graphics:
-NONE, DOOR, RADS, FIRE, INFO, AQI, CO2, WATER, GAS, FREEZE, ALERT, SAFE, GARAGE
+See the list at the top of include/graphics.h, generated with the GRAPHICS table from content/graphics/graphics.csv.
+Uploaded graphics (see graphic-store.h) are accepted by label too.
 
 *** Diagnostics ***
 
 Publishes diagnostic information according to refresh frequency.
 
-homeassistant/siren/featheresp32s2/diagnostics >>> { "wifi_rssi": -43, "wifi_ip": "10.0.0.177", "wifi_mac": "84:F7:03:D6:8B:20" }
+homeassistant/siren/featheresp32s2/diagnostics >>> { "wifi_rssi": -43, "wifi_ip": "10.0.0.177", "wifi_mac": "84:F7:03:D6:8B:20", "audio_preempted": 0, "audio_coalesced": 3, "audio_dropped": 1, "stream_underruns": 0, "stream_bitrate": 128, "playback_tone": "/tones/alarm.mp3", "playback_underruns": 0, "playback_feed_gap_ms": 9, "playback_bytes": 163840, "playback_bitrate": 128, "spi_sd_busy": 4.2, "spi_codec_busy": 1.3, "spi_codec_waits": 12, "spi_codec_wait_ms": 3, "display_flush_bytes": 390, "graphic_cache_hits": 14, "graphic_cache_misses": 2, "graphic_load_ms": 4.8 }
+
+Also published as soon as each tone (or sequence, or stream) ends, with the playback_* fields describing that playback.
+The spi_* fields cover the time since the previous diagnostics: the share of it the SD card and the codec held the shared
+SPI bus, and how often (and at worst how long) a write to the codec had to wait for it.
 
 *** Configuration *** 
 
@@ -120,6 +158,7 @@ mqtt:
 
 #include "chime.h"
 #include "graphics.h"
+#include "glyphs.h"
 
 // Time
 const char* ntpServer = NTP_SERVER;
@@ -132,18 +171,26 @@ Adafruit_BME280 bme; // I2C
 
 Adafruit_VS1053_FilePlayer musicPlayer = Adafruit_VS1053_FilePlayer(VS1053_RESET, VS1053_CS, VS1053_DCS, VS1053_DREQ, CARDCS);
 
-// 128x128 SSD1327 display connected via I2C
-Adafruit_SSD1327 display(DISPLAY_WIDTH, DISPLAY_HEIGHT, &Wire, OLED_RESET, 1000000);
+// 128x128 SSD1327 display connected via I2C; only the regions that changed are sent (see display-panel.h)
+DisplayPanel display(DISPLAY_WIDTH, DISPLAY_HEIGHT, &Wire, OLED_RESET, 1000000);
 // software SPI
 //Adafruit_SSD1327 display(128, 128, OLED_MOSI, OLED_CLK, OLED_DC, OLED_RESET, OLED_CS);
 // hardware SPI
 //Adafruit_SSD1327 display(128, 128, &SPI, OLED_DC, OLED_RESET, OLED_CS);
 
+// display command on screen (CRC32 and length of its payload); length -1 when the screen shows anything else
+uint32_t shown_display_hash = 0;
+int shown_display_len = -1;
+
 WiFiClient wificlient;
-MQTTClient mqttclient(768); // default is 128 bytes;  https://github.com/256dpi/arduino-mqtt#notes
+// default is 128 bytes;  https://github.com/256dpi/arduino-mqtt#notes
+// Incoming messages must fit a tone upload chunk (see tone-upload.h); 768 bytes is plenty for anything published.
+MQTTClient mqttclient(sizeof(tone_upload_frame) + TONE_UPLOAD_CHUNK + 256, 768);
 
 unsigned long refresh_rate = 60000; // 1 minutes default; frequency of sensor updates in milliseconds
 
+audio_playback_stats last_playback; // summary of the most recently finished playback, repeated in every diagnostics payload
+
 /*
   Since the fully constructed list of discovery_config (topics and payloads) consumes considerable RAM, reduce it to just the facts.
   Generate each discovery_config one at a time at the point of publishing the message in order to conserve RAM.
@@ -162,27 +209,34 @@ const std::string DIAGNOSTIC_TOPIC = buildDiagnosticTopic("siren", std::string(D
 // All sensor updates are published in a single complex json payload to a single topic
 const std::string STATE_TOPIC = buildStateTopic("siren", std::string(DEVICE_ID)); // homeassistant/siren/featheresp32s2/state
 
+// Tone upload (see tone-upload.h); the sender is test/siren/upload-tone.py
+const std::string UPLOAD_BEGIN_TOPIC = "homeassistant/siren/" DEVICE_ID "/upload/begin";    // { "name": "bell.mp3", "size": 12345, "crc": 305419896, "chunk": 4096 }
+const std::string UPLOAD_CHUNK_TOPIC = "homeassistant/siren/" DEVICE_ID "/upload/chunk";    // binary; tone_upload_frame followed by the chunk
+const std::string UPLOAD_STATUS_TOPIC = "homeassistant/siren/" DEVICE_ID "/upload/status";  // progress, for the sender
+
 const std::string ON_VALUE = "ON";
 const std::string OFF_VALUE = "OFF";
 
 // *****************************
 
-std::vector<std::string> availableTones(File dir){
+/*
+  Names of all playable tones, from the tone index (see tone-index.h) rather than a walk of the SD card.
+*/
+std::vector<std::string> availableTones(){
   std::vector<std::string> tones = { }; 
 
-  Sprintln("Found tones:");
-  while(true) {     
-     File entry =  dir.openNextFile();
-     if(!entry) {
-       // no more files       
-       break;
-     }
-     if(!entry.isDirectory()){
-      Sprint("\t"); Sprintln(entry.name());
-      tones.push_back(entry.name());
-     }   
-     entry.close();
-   }
+  for(size_t i = 0; i < toneIndexCount(); i++){
+    const tone_record *rec = toneIndexAt(i);
+    if(rec->codec != TONE_CODEC_UNKNOWN){
+      tones.push_back(rec->name);
+    }
+  }
+  // critical tones in flash play with or without the SD card
+  for(size_t i = 0; i < toneStoreCount(); i++){
+    if(toneIndexFind(toneStoreName(i)) == NULL){
+      tones.push_back(toneStoreName(i));
+    }
+  }
   
   return tones;
 }
@@ -229,10 +283,10 @@ std::vector<discovery_config_metadata> getAllDiscoveryConfigMessagesMetadata(){
   discovery_config_metadata refrate, siren, display;
 
   /*
-  Dynamically build list of available tones from all files in /tones directory on SD card.
+  Dynamically build list of available tones from all playable files in /tones directory on SD card (via the tone index).
   */
-  std::vector<std::string> tones = availableTones(SD.open(TONE_DIR));
-  std::string custom_settings = "\"optimistic\": false, \"support_duration\": false, \"support_volume_set\": true, \"available_tones\": [";  
+  std::vector<std::string> tones = availableTones();
+  std::string custom_settings = "\"optimistic\": false, \"support_duration\": true, \"support_volume_set\": true, \"available_tones\": [";  
   bool first = true;
   for(int i=0;i < tones.size(); i++){
     if(first){
@@ -269,13 +323,13 @@ std::vector<discovery_config_metadata> getAllDiscoveryConfigMessagesMetadata(){
 
   display.device_type = "text";
   display.control_name = "display";
-  display.custom_settings = "\"min\": 0, \"max\": 84"; // 255 is the max
   display.icon = "mdi:image-text";
   display.unit = "";
   // override default get/set topic names
   display.set_topic = "homeassistant/text/featheresp32s2/display/command"; // command payload= { "text": "Basement smoke detector triggered!", "graphic": "FIRE" }
   display.get_topic = "homeassistant/text/featheresp32s2/display/state"; // device reflects command payload to the state topic (same as above)
-  display.custom_settings = "\"command_template\": \"{ 'text': '{{ value }}', 'graphic': 'NONE' }\", \"value_template\": \"{{ value_json.text }}\""; // need to extract value of text attribute in order to be compatible with "text" device type
+  // need to extract value of text attribute in order to be compatible with "text" device type; text that does not fit scrolls
+  display.custom_settings = "\"min\": 0, \"max\": " + to_string(DISPLAY_TEXT_MAX) + ", \"command_template\": \"{ 'text': '{{ value }}', 'graphic': 'NONE' }\", \"value_template\": \"{{ value_json.text }}\"";
 
   std::vector<discovery_config_metadata> dcm = { refrate, siren, display };  
   return dcm;
@@ -290,8 +344,120 @@ std::vector<discovery_measured_diagnostic_metadata> getAllDiscoveryMeasuredDiagn
   rssi.diag_attr = "wifi_rssi";
   rssi.icon = "mdi:wifi-strength-2";  // https://materialdesignicons.com/
   rssi.unit = ""; // RSSI is unitless
+
+  // siren requests interrupted, merged or ignored by the audio arbiter since boot
+  discovery_measured_diagnostic_metadata preempted, coalesced, dropped;
+
+  preempted.device_type = "sensor";
+  preempted.device_class = "";
+  preempted.state_class = "total_increasing";
+  preempted.diag_attr = "audio_preempted";
+  preempted.icon = "mdi:volume-high";
+  preempted.unit = "";
+
+  coalesced.device_type = "sensor";
+  coalesced.device_class = "";
+  coalesced.state_class = "total_increasing";
+  coalesced.diag_attr = "audio_coalesced";
+  coalesced.icon = "mdi:bell-ring";
+  coalesced.unit = "";
+
+  dropped.device_type = "sensor";
+  dropped.device_class = "";
+  dropped.state_class = "total_increasing";
+  dropped.diag_attr = "audio_dropped";
+  dropped.icon = "mdi:volume-off";
+  dropped.unit = "";
+
+  // HTTP streaming; see audio-stream.h
+  discovery_measured_diagnostic_metadata underruns, bitrate;
+
+  underruns.device_type = "sensor";
+  underruns.device_class = "";
+  underruns.state_class = "total_increasing";
+  underruns.diag_attr = "stream_underruns";
+  underruns.icon = "mdi:wifi-alert";
+  underruns.unit = "";
+
+  bitrate.device_type = "sensor";
+  bitrate.device_class = "data_rate";
+  bitrate.diag_attr = "stream_bitrate";
+  bitrate.icon = "mdi:speedometer";
+  bitrate.unit = "kbit/s";
+
+  // last playback's summary; see audioPlaybackSummary()
+  discovery_measured_diagnostic_metadata playback_underruns, playback_gap, playback_bitrate;
+
+  playback_underruns.device_type = "sensor";
+  playback_underruns.device_class = "";
+  playback_underruns.diag_attr = "playback_underruns";
+  playback_underruns.icon = "mdi:music-note-off";
+  playback_underruns.unit = "";
+
+  playback_gap.device_type = "sensor";
+  playback_gap.device_class = "duration";
+  playback_gap.diag_attr = "playback_feed_gap_ms";
+  playback_gap.icon = "mdi:timer-alert-outline";
+  playback_gap.unit = "ms";
+
+  playback_bitrate.device_type = "sensor";
+  playback_bitrate.device_class = "data_rate";
+  playback_bitrate.diag_attr = "playback_bitrate";
+  playback_bitrate.icon = "mdi:speedometer";
+  playback_bitrate.unit = "kbit/s";
   
-  std::vector<discovery_measured_diagnostic_metadata> dmdm = { rssi };  
+  // shared SPI bus; see spi-bus.h
+  discovery_measured_diagnostic_metadata spi_sd_busy, spi_codec_busy, spi_codec_wait;
+
+  spi_sd_busy.device_type = "sensor";
+  spi_sd_busy.device_class = "";
+  spi_sd_busy.diag_attr = "spi_sd_busy";
+  spi_sd_busy.icon = "mdi:sd";
+  spi_sd_busy.unit = "%";
+
+  spi_codec_busy.device_type = "sensor";
+  spi_codec_busy.device_class = "";
+  spi_codec_busy.diag_attr = "spi_codec_busy";
+  spi_codec_busy.icon = "mdi:speaker";
+  spi_codec_busy.unit = "%";
+
+  spi_codec_wait.device_type = "sensor";
+  spi_codec_wait.device_class = "duration";
+  spi_codec_wait.diag_attr = "spi_codec_wait_ms";
+  spi_codec_wait.icon = "mdi:timer-sand";
+  spi_codec_wait.unit = "ms";
+
+  // bytes sent to the display by its most recent update; see display-panel.h
+  discovery_measured_diagnostic_metadata display_flush;
+
+  display_flush.device_type = "sensor";
+  display_flush.device_class = "data_size";
+  display_flush.diag_attr = "display_flush_bytes";
+  display_flush.icon = "mdi:monitor-arrow-down";
+  display_flush.unit = "B";
+
+  // uploaded graphics: shown from PSRAM, read from the SD card, and how long the most recent read took; see graphic-store.h
+  discovery_measured_diagnostic_metadata graphic_hits, graphic_misses, graphic_load;
+
+  graphic_hits.device_type = "sensor";
+  graphic_hits.device_class = "";
+  graphic_hits.diag_attr = "graphic_cache_hits";
+  graphic_hits.icon = "mdi:image-check";
+  graphic_hits.unit = "";
+
+  graphic_misses.device_type = "sensor";
+  graphic_misses.device_class = "";
+  graphic_misses.diag_attr = "graphic_cache_misses";
+  graphic_misses.icon = "mdi:image-refresh";
+  graphic_misses.unit = "";
+
+  graphic_load.device_type = "sensor";
+  graphic_load.device_class = "duration";
+  graphic_load.diag_attr = "graphic_load_ms";
+  graphic_load.icon = "mdi:timer-sand";
+  graphic_load.unit = "ms";
+
+  std::vector<discovery_measured_diagnostic_metadata> dmdm = { rssi, preempted, coalesced, dropped, underruns, bitrate, playback_underruns, playback_gap, playback_bitrate, spi_sd_busy, spi_codec_busy, spi_codec_wait, display_flush, graphic_hits, graphic_misses, graphic_load };  
   return dmdm;
 }
 
@@ -341,92 +507,64 @@ discovery_config getDiscoveryMessage(discovery_fact_diagnostic_metadata disc_met
 // *****************************
 
 /*
-  Using text size = 1, fits 336 chars (21 chars over 16 lines)
-  Using text size = 2, fits 80 chars (10 chars over 8 lines)
-  Use '\n' to insert linefeed in string.
+  Send the frame to the panel. Only what changed since the previous flush goes over I2C, and it is sent by the display's
+  flush task (see display-panel.h), so this returns as soon as the frame is handed over.
 */
-void displayMessage(uint8_t size, const char* message){
-
-    display.clearDisplay();
-
-    display.setTextSize(size);
-    display.setTextColor(SSD1327_WHITE);
-    display.setCursor(0,0);
-    display.println(message);
+void displayFlush(){
+  display.display();
+  shown_display_len = -1; // until processMessages() says which command this frame is
+}
 
-    display.display();
+void showingDisplayCommand(uint32_t hash, int len){
+  shown_display_hash = hash;
+  shown_display_len = len;
 }
 
 /*
-  Title should be <= 10 chars
+  Screens are drawn by display-screens.cpp (see display-screens.h for what fits on them), then sent.
 */
-void displayMessage(const char* title, const char* message){
-    display.clearDisplay();
-    
-    display.setTextSize(2); // 12x16
-    display.setTextColor(SSD1327_BLACK, SSD1327_WHITE); // 'inverted' text
-    display.setCursor(0,0);
-    display.print(title);
-
-    display.setTextSize(1); // 6x8
-    display.setTextColor(SSD1327_WHITE);    
-    display.setCursor(0,17);    
-    display.println(message);  
-
-    display.display();
+void displayMessage(uint8_t size, const char* message, display_scroll_mode scroll = DISPLAY_SCROLL_PAGES){
+  drawTextScreen(display, size, message, scroll);
+  displayFlush();
 }
 
-/*  
-  Message will be displayed in size 1. 
-  Up to 84 chars (4 full lines) can be displayed under a 96x96 graphic.
-  Graphic will be centered and top-justified.
+void displayMessage(const char* title, const char* message){
+  drawTitledScreen(display, title, message);
+  displayFlush();
+}
 
+/*
   Usage:
-  displayGraphic("ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTU", FIRE_BITMAP, FIRE_WIDTH, FIRE_HEIGHT);
+  displayGraphic("ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTU", findGraphic("FIRE"));
 */
-void displayGraphic(const char* message, const u_int8_t* bitmap, uint16_t bitmap_w, uint16_t bitmap_h){  
-  display.clearDisplay();
-  display.drawBitmap((int)((DISPLAY_WIDTH-bitmap_w)/2), 0,  bitmap, bitmap_w, bitmap_h, SSD1327_WHITE);  
-
-  if(strlen(message)>0){ // ensure message is not null
-    display.setTextSize(1); // 6x8
-    display.setTextColor(SSD1327_WHITE);    
-    display.setCursor(0,bitmap_h); // start text left justified under graphic   
-    display.println(message);  
-  }
-
-  display.display();    
+void displayGraphic(const char* message, const graphic_entry *graphic, display_scroll_mode scroll = DISPLAY_SCROLL_PAGES){
+  drawGraphicScreen(display, message, graphic->bitmap, graphic->depth, graphic->width, graphic->height, scroll);
+  displayFlush();
 }
 
 void displayClear(){  
   display.clearDisplay();
-  display.display();    
+  displayFlush();
 }
 
 void displayWifiOffline(){
-  displayGraphic("Unable to connect to network!", WIFI_ALERT_BITMAP, WIFI_ALERT_WIDTH, WIFI_ALERT_HEIGHT);    
+  displayGraphic("Unable to connect to network!", &WIFI_ALERT_GRAPHIC);    
 }
 
 void displayMQTTOffline(){
-  displayGraphic("Unable to connect to MQTT broker!", MQTT_ALERT_BITMAP, MQTT_ALERT_WIDTH, MQTT_ALERT_HEIGHT);    
+  displayGraphic("Unable to connect to MQTT broker!", &MQTT_ALERT_GRAPHIC);    
 }
 
 void displayBroken(const char *message){
-  displayGraphic(message, BROKEN_BITMAP, BROKEN_WIDTH, BROKEN_HEIGHT);    
+  displayGraphic(message, &BROKEN_GRAPHIC);    
 }
 
 
 /*
-  This will begin playing the tone.
-  With useInterrupts() functional, a hardware interrupt will cause the automatic invocation of feedBuffer().
-  However, without this hardware interrupt, feedBuffer() must be explicitly called until musicPlayer.playingMusic is FALSE (see loop()).
+  Set volume for left, right channels from Home Assistant's 0.0..1.0 volume level.
+  While a tone is playing the change is ramped over fade_ms (0 is immediate).
 */
-void activateSiren(const char *tone, float volume_level, int duration /*ignored*/){  
-  Sprintln(F("Activate siren!"));
-  Sprint("tone = "); Sprintln(tone);
-  Sprint("volume_level = "); Sprintln(volume_level);
-  Sprint("duration = "); Sprintln(duration);
-
+void setSirenVolume(float volume_level, uint16_t fade_ms){
   // VOLUME
   // Set volume for left, right channels. lower numbers == louder volume!
   uint8_t vol = 0;
@@ -434,38 +572,173 @@ void activateSiren(const char *tone, float volume_level, int duration /*ignored*
     vol = ceil(255 * volume_level); // 1..255  where 1 is quietest, 255 loudest
     vol = 256 - vol; // 1..255  where 1 is loudest, 255 is quietest
   }  
-  musicPlayer.setVolume(vol,vol);  
+  audioSetVolume(vol, fade_ms);
   Sprint("vol = "); Sprintln(vol);
+}
 
-  // DURATION
-  //?
-  
-  /*
+/*
   Since the tone names are the actual filenames (restricted to 8.3 on FAT formatted SDcard), all 
   this does is prepends the directory path where the tones are stored. 
 
   alarm.mp3 --> /tones/alarm.mp3
-  */
-  String filename = TONE_DIR + String("/") + String(tone); // /tones/alarm.mp3  
-     
-  Sprint(F("Playing file: ")); Sprintln(filename);
+*/
+String toneFilename(const char *tone){
+  return TONE_DIR + String("/") + String(tone); // /tones/alarm.mp3  
+}
+
+/*
+  Fill a playlist entry for tone from the tone index, so the audio task can seek straight to its audio data.
+  A tone only in the flash tone store (the SD card may be missing) is located by the audio task when it opens it.
+  Returns false, without touching the SD card, if tone is not a known playable file.
+*/
+bool toneEntry(const char *tone, audio_entry &entry){
+  const tone_record *rec = toneIndexFind(tone);
+  const uint8_t *stored;
+  size_t stored_size;
+  if(rec == NULL && !toneStoreFind(tone, &stored, &stored_size)){
+    Sprint(F("Unknown tone: ")); Sprintln(tone == NULL ? "(none)" : tone);
+    return false;
+  }
+  String filename = toneFilename(tone);
+  strncpy(entry.path, filename.c_str(), AUDIO_PATH_LEN - 1);
+  entry.path[AUDIO_PATH_LEN - 1] = '\0';
+  entry.data_offset = rec != NULL ? rec->data_offset : -1;
+  entry.wav_length_field = rec != NULL ? rec->wav_length_field : -1;
+  return true;
+}
+
+/*
+  Playlist for a single tone.
+  DURATION: seconds; the tone loops gaplessly until the audio task's timer stops it. 0 or less plays the tone once.
+*/
+bool sirenPlaylist(const char *tone, int duration, audio_playlist &playlist){
+  Sprint("tone = "); Sprintln(tone == NULL ? "(none)" : tone);
+  Sprint("duration = "); Sprintln(duration);
+
+  if(!toneEntry(tone, playlist.entries[0])){
+    return false;
+  }
+  playlist.entries[0].repeat = duration > 0 ? 0 : 1; // loop until duration elapses
+  playlist.count = 1;
+  playlist.duration_ms = duration > 0 ? duration * 1000 : 0;
+  return true;
+}
+
+/*
+  Playlist for an ordered sequence of tones, for example a chime, then an announcement, then the chime again.
+  [ { "tone": "chime.wav", "repeat": 1, "gap_ms": 500 }, { "tone": "announce.mp3" }, { "tone": "chime.wav" } ]
+
+  repeat defaults to 1 (0 repeats until stopped or duration elapses), gap_ms defaults to 0 (gapless).
+  Unknown tones are skipped. Entries beyond AUDIO_MAX_SEQUENCE are ignored.
+*/
+bool sirenPlaylist(JsonArrayConst sequence, int duration, audio_playlist &playlist){
+  Sprint("duration = "); Sprintln(duration);
+
+  playlist.duration_ms = duration > 0 ? duration * 1000 : 0;
+  for(JsonObjectConst item : sequence){
+    if(playlist.count >= AUDIO_MAX_SEQUENCE){
+      Sprintln(F("Sequence too long; truncated"));
+      break;
+    }
+    audio_entry &entry = playlist.entries[playlist.count];
+    if(!toneEntry(item["tone"], entry)){
+      continue;
+    }
+    entry.repeat = item["repeat"] | 1;
+    entry.gap_ms = item["gap_ms"] | 0;
+    playlist.count++;
+    Sprint(F("Sequence tone: ")); Sprintln(entry.path);
+  }
+  return playlist.count > 0;
+}
+
+/*
+  Playlist for an HTTP stream, e.g. http://homeassistant.local:8123/api/tts_proxy/abc.mp3
+  The URL itself is handed to the audio task alongside the playlist.
+*/
+bool streamPlaylist(const char *url, int duration, audio_playlist &playlist){
+  Sprint("url = "); Sprintln(url);
+  Sprint("duration = "); Sprintln(duration);
+
+  if(strncmp(url, "http://", 7) != 0 || strlen(url) >= AUDIO_URL_LEN){
+    Sprintln(F("Unsupported stream URL"));
+    return false;
+  }
+  playlist.entries[0].stream = true;
+  playlist.count = 1;
+  playlist.duration_ms = duration > 0 ? duration * 1000 : 0;
+  return true;
+}
+
+/*
+  MIDI note sequence played by the codec's synthesiser; no SD card access at all.
+  [ [program, note, velocity, duration_ms], ... ]  e.g. Westminster chimes on tubular bells (14):
+  [ [14,76,100,500], [14,72,100,500], [14,74,100,500], [14,67,100,1000] ]
+
+  A velocity of 0 is a rest. Entries beyond AUDIO_MIDI_MAX_NOTES are ignored.
+*/
+bool midiSequence(JsonArrayConst notes, audio_midi_sequence &sequence){
+  for(JsonArrayConst item : notes){
+    if(sequence.count >= AUDIO_MIDI_MAX_NOTES){
+      Sprintln(F("MIDI sequence too long; truncated"));
+      break;
+    }
+    if(item.size() != 4){
+      Sprintln(F("Invalid MIDI note; expected [program, note, velocity, duration_ms]"));
+      return false;
+    }
+    audio_midi_note &note = sequence.notes[sequence.count++];
+    note.program = constrain(item[0].as<int>(), 0, 127);
+    note.note = constrain(item[1].as<int>(), 0, 127);
+    note.velocity = constrain(item[2].as<int>(), 0, 127);
+    note.duration_ms = constrain(item[3].as<int>(), 0, 65535);
+  }
+  Sprint(F("MIDI notes: ")); Sprintln(sequence.count);
+  return sequence.count > 0;
+}
+
+/*
+  This will begin playing the MIDI sequence.
+*/
+void activateSiren(const audio_midi_sequence &sequence, float volume_level){
+  Sprintln(F("Activate siren (MIDI)!"));
+  Sprint("volume_level = "); Sprintln(volume_level);
+
+  setSirenVolume(volume_level, 0);
+
+  if(!audioPlayMidi(sequence)){
+    Sprintln(F("Failed to play!"));
+  }
+}
+
+/*
+  This will begin playing the playlist.
+  Playback is queued to the audio task (see audio-player.h), which feeds the codec on every DREQ edge independently of loop().
+*/
+void activateSiren(const audio_playlist &playlist, float volume_level, const char *url){  
+  Sprintln(F("Activate siren!"));
+  Sprint("volume_level = "); Sprintln(volume_level);
+
+  setSirenVolume(volume_level, 0); // any fade-in is done by the playlist
 
   // This will starve the main loop() until the tone is completely played.
   // if(musicPlayer.playFullFile(filename)){
   //   Sprintln("play end");
   // }
-  if(!musicPlayer.startPlayingFile(filename.c_str())){    
+  if(!audioPlay(playlist, url)){    
     Sprintln(F("Failed to play!"));
   }  
 }
 
 
-void deactivateSiren(){  
+/*
+  Stop playback, fading out over fade_ms first (0 stops immediately).
+*/
+void deactivateSiren(uint16_t fade_ms){  
   Sprintln(F("Deactivate siren"));
+  Sprint("fade_ms = "); Sprintln(fade_ms);
 
-  if(!musicPlayer.stopped()){
-    musicPlayer.stopPlaying();
-  }
+  audioStop(fade_ms);
 }
 
 void printDirectory(File dir, int numTabs) {
@@ -556,11 +829,38 @@ void publishSensorData(){
 
 void publishDiagnosticData(){  
 
+  const audio_arbiter_stats &arbiter = audioArbiterStats();
+  const audio_stream_stats &stream = audioStreamStats();
+  const graphic_store_stats &graphics = graphicStoreStats();
+  spi_bus_sample bus;
+  spiBusSample(bus);
+  char sd_busy[8], codec_busy[8];
+  snprintf(sd_busy, sizeof(sd_busy), "%.1f", bus.busy_pct[SPI_DEVICE_SD]);
+  snprintf(codec_busy, sizeof(codec_busy), "%.1f", bus.busy_pct[SPI_DEVICE_CODEC_DATA] + bus.busy_pct[SPI_DEVICE_CODEC_CMD]);
+
   std::string payload = "{\
 \"wifi_rssi\": "+to_string(getRSSI())+", \
 \"wifi_ip\": \""+getIP()+"\", \
 \"wifi_mac\": \""+getMAC()+"\", \
-\"last_boot\": \""+lastboot+"\" \
+\"last_boot\": \""+lastboot+"\", \
+\"audio_preempted\": "+to_string((int)arbiter.preempted)+", \
+\"audio_coalesced\": "+to_string((int)arbiter.coalesced)+", \
+\"audio_dropped\": "+to_string((int)arbiter.dropped)+", \
+\"stream_underruns\": "+to_string((int)stream.underruns)+", \
+\"stream_bitrate\": "+to_string((int)(stream.bitrate / 1000))+", \
+\"playback_tone\": \""+std::string(last_playback.source)+"\", \
+\"playback_underruns\": "+to_string((int)last_playback.underruns)+", \
+\"playback_feed_gap_ms\": "+to_string((int)last_playback.longest_gap_ms)+", \
+\"playback_bytes\": "+to_string((int)last_playback.bytes)+", \
+\"playback_bitrate\": "+to_string((int)(last_playback.bitrate / 1000))+", \
+\"spi_sd_busy\": "+std::string(sd_busy)+", \
+\"spi_codec_busy\": "+std::string(codec_busy)+", \
+\"spi_codec_waits\": "+to_string((int)bus.waits[SPI_DEVICE_CODEC_DATA])+", \
+\"spi_codec_wait_ms\": "+to_string((int)bus.longest_wait_ms[SPI_DEVICE_CODEC_DATA])+", \
+\"display_flush_bytes\": "+to_string((int)display.lastFlush().bytes)+", \
+\"graphic_cache_hits\": "+to_string((int)graphics.hits)+", \
+\"graphic_cache_misses\": "+to_string((int)graphics.misses)+", \
+\"graphic_load_ms\": "+to_string((float)graphics.last_load_us / 1000, "%.1f")+" \
 }";
 
   const char* payload_ch = payload.c_str();
@@ -617,17 +917,46 @@ void processMessages(){
           state: ON,
           volume_level: 0.0..1.0,
           tone: [alarm.mp3|doorbell.wav|...],
-          duration: 0..n     NOT SUPPORTED 
+          duration: 0..n     seconds,
+          priority: 0..255   (optional),
+          fade_ms: 0..n      (optional)
         }  
         OR
         {
-          state: OFF
+          state: ON,
+          volume_level: 0.0..1.0,
+          sequence: [ { tone: chime.wav, repeat: 1, gap_ms: 500 }, { tone: announce.mp3 }, ... ],
+          duration: 0..n     seconds (optional; stops the sequence),
+          priority: 0..255   (optional),
+          fade_ms: 0..n      (optional)
+        }
+        OR
+        {
+          state: ON,
+          volume_level: 0.0..1.0,
+          url: http://...    streamed in place of a tone,
+          duration: 0..n     seconds (optional),
+          priority: 0..255   (optional),
+          fade_ms: 0..n      (optional)
+        }
+        OR
+        {
+          state: ON,
+          volume_level: 0.0..1.0,
+          midi: [ [program, note, velocity, duration_ms], ... ],
+          priority: 0..255   (optional)
+        }
+        OR
+        {
+          state: OFF,
+          fade_ms: 0..n      (optional)
         }       
       */
       
       // Inside the brackets is the capacity of the memory pool in bytes.      
       // Use https://arduinojson.org/v6/assistant to compute the capacity.
-      StaticJsonDocument<128> doc;
+      // Sized for a sequence filling a 768 byte command (the MQTT read buffer is only larger for tone upload chunks).
+      StaticJsonDocument<1024> doc;
 
       DeserializationError error = deserializeJson(doc, op.value);
 
@@ -650,16 +979,71 @@ void processMessages(){
           //Sprint("volume_set = "); Sprintln(volume_set);          
 
           const char* tone = doc["tone"];             // "doorbell.wav" | "alarm.mp3"  (only pre-defined tones will be allowed by Home Assistant)
-          //int duration = doc["duration"];           // 999    
-          int duration = -1;
-
-          activateSiren(tone, volume_set, duration);
+          // seconds; Home Assistant may send this as a string ("10") when it comes from service data
+          int duration = doc["duration"].is<const char*>() ? atoi(doc["duration"].as<const char*>()) : doc["duration"].as<int>();
+          uint8_t priority = doc["priority"] | AUDIO_PRIORITY_DEFAULT;
+          uint16_t fade_ms = doc["fade_ms"] | 0;     // fade in, and fade out when duration elapses
+
+          // validate against the tone index before anything that is playing can be interrupted
+          const char* url = doc["url"];               // stream in place of a tone
+          bool midi = doc["midi"].is<JsonArrayConst>();  // note sequence in place of a tone
+          audio_playlist playlist;
+          audio_midi_sequence sequence;
+          bool valid;
+          if(midi){
+            valid = midiSequence(doc["midi"].as<JsonArrayConst>(), sequence);
+          }
+          else if(url != NULL){
+            valid = streamPlaylist(url, duration, playlist);
+          }
+          else if(doc["sequence"].is<JsonArrayConst>()){
+            valid = sirenPlaylist(doc["sequence"].as<JsonArrayConst>(), duration, playlist);
+          }
+          else{
+            valid = sirenPlaylist(tone, duration, playlist);
+          }
+          playlist.fade_in_ms = fade_ms;
+          playlist.fade_out_ms = fade_ms;
+          if(!valid){
+            Sprintln(F("Siren command rejected; nothing to play"));
+            if(!audioIsPlaying()){
+              std::string payload = "{\"state\": \""+OFF_VALUE+"\"}";
+              publish(op.config_meta.get_topic.c_str(), payload.c_str());
+            }
+          }
+          else{
+            switch(arbitrateAudio(priority, AUDIO_COALESCE_WINDOW_MS)){
+              case ARBITER_PREEMPT:
+                Sprint(F("Siren preempted by priority ")); Sprintln(priority);
+                // fall through
+              case ARBITER_PLAY:
+                if(midi){
+                  activateSiren(sequence, volume_set);
+                }
+                else{
+                  activateSiren(playlist, volume_set, url);
+                }
+                // publish updated value - reflects command payload as state update
+                publish(op.config_meta.get_topic.c_str(), op.value);
+                break;
+              case ARBITER_COALESCE:
+                Sprintln(F("Siren command coalesced into current playback"));
+                // the playing tone carries on, ramped to the volume of the latest request
+                if(doc.containsKey("volume_set")){
+                  setSirenVolume(volume_set, fade_ms);
+                }
+                break;
+              case ARBITER_DROP:
+                Sprint(F("Siren command dropped; priority too low: ")); Sprintln(priority);
+                break;
+            }
+          }
         }
         else{          
-          deactivateSiren();
+          deactivateSiren(doc["fade_ms"] | 0);
+          // publish updated value - reflects command payload as state update
+          publish(op.config_meta.get_topic.c_str(), op.value);
         }        
-        // publish updated value - reflects command payload as state update
-        publish(op.config_meta.get_topic.c_str(), op.value);
       }
       // once processed, remove from queue
       pending_ops.pop(); // deletes from front
@@ -679,15 +1063,25 @@ void processMessages(){
       pending_ops.pop(); // deletes from front
     }  
     else if(op.config_meta.control_name.compare("display") == 0){
+      // mqtt2chime repeats the command for what is on screen with every sensor message; see display-frame-cache.h
+      uint32_t hash = crc32_le(0, (const uint8_t *)op.value.c_str(), op.value.length());
 
-      if(op.value.isEmpty()){ // if command is empty, clear display
-        display.clearDisplay();
-        display.display();
+      if(shown_display_len == (int)op.value.length() && shown_display_hash == hash){
+        Sprintln(F("Display command already shown"));
+      }
+      else if(op.value.isEmpty()){ // if command is empty, clear display
+        displayClear();
+        showingDisplayCommand(hash, 0);
+      }
+      else if(displayFrameCacheLoad(hash, op.value.length(), display.getBuffer())){ // rendered before: the frame as it was
+        display.stopScroll();
+        displayFlush();
+        showingDisplayCommand(hash, op.value.length());
       }
       else{ // command is not empty...            
         // Inside the brackets is the capacity of the memory pool in bytes.      
         // Use https://arduinojson.org/v6/assistant to compute the capacity.
-        StaticJsonDocument<128> doc;        
+        StaticJsonDocument<JSON_OBJECT_SIZE(3) + DISPLAY_TEXT_MAX + 64> doc;
         DeserializationError error = deserializeJson(doc, op.value);
 
         if(error) {
@@ -697,59 +1091,39 @@ void processMessages(){
         }
         else
         {        
-          const char* text = doc["text"]; // up to 84 characters
+          const char* text = doc["text"]; // up to DISPLAY_TEXT_MAX characters; 84 fit under a graphic, the rest scroll
           const char* graphic = doc["graphic"]; // up to 15 characters mapping to graphic name   
+          const char* scroll = doc["scroll"]; // optional: "marquee" for one line moving left, rather than pages
+          display_scroll_mode mode = scroll != NULL && strcmp(scroll, "marquee") == 0 ? DISPLAY_SCROLL_MARQUEE : DISPLAY_SCROLL_PAGES;
 
           Sprint("display graphic: "); Sprintln(graphic);       
           Sprintln(text);
 
-          // map requested "graphic" to matching bitmap
-          if(strcmp(graphic, NONE_LABEL)==0){ 
-            displayMessage(1,text);
-          }  
-          else if(strcmp(graphic, MEDIUM_TEXT_LABEL)==0){
-            displayMessage(2,text);
-          }            
-          else if(strcmp(graphic, LARGE_TEXT_LABEL)==0){
-            displayMessage(3,text);
-          }                   
-          else if(strcmp(graphic, AQI_LABEL)==0){ 
-            displayGraphic(text, AQI_BITMAP, AQI_WIDTH, AQI_HEIGHT);
+          // map requested "graphic" to an uploaded graphic (see graphic-store.h), or else its entry in the registry
+          // (see graphics.h); INFO if there is no such graphic
+          graphic_entry uploaded;
+          const graphic_entry *entry = NULL;
+          const graphic_asset *asset = graphicStoreFind(graphic);
+          if(asset != NULL){
+            uploaded = { asset->label, GRAPHIC_ICON, 1, asset->depth, asset->bitmap, asset->width, asset->height };
+            entry = &uploaded;
+          }
+          else{
+            entry = findGraphic(graphic);
+          }
+          if(entry == NULL){
+            entry = DEFAULT_GRAPHIC;
           }
-          else if(strcmp(graphic, FIRE_LABEL)==0){
-            displayGraphic(text, FIRE_BITMAP, FIRE_WIDTH, FIRE_HEIGHT);
+          if(entry->style == GRAPHIC_TEXT){
+            displayMessage(entry->text_size, text, mode);
           }
-          else if(strcmp(graphic, CO2_LABEL)==0){
-            displayGraphic(text, CO2_BITMAP, CO2_WIDTH, CO2_HEIGHT);
-          } 
-          else if(strcmp(graphic, RADIATION_LABEL)==0){
-            displayGraphic(text, RADIATION_BITMAP, RADIATION_WIDTH, RADIATION_HEIGHT);
-          }            
-          else if(strcmp(graphic, DOORBELL_LABEL)==0){
-            displayGraphic(text, DOORBELL_BITMAP, DOORBELL_WIDTH, DOORBELL_HEIGHT);
-          }  
-          else if(strcmp(graphic, GARAGE_LABEL)==0){
-            displayGraphic(text, GARAGE_BITMAP, GARAGE_WIDTH, GARAGE_HEIGHT);
-          }                             
-          else if(strcmp(graphic, SAFETY_LABEL)==0){
-            displayGraphic(text, SAFETY_BITMAP, SAFETY_WIDTH, SAFETY_HEIGHT);
-          } 
-          else if(strcmp(graphic, ALERT_LABEL)==0){
-            displayGraphic(text, ALERT_BITMAP, ALERT_WIDTH, ALERT_HEIGHT);
-          } 
-          else if(strcmp(graphic, FREEZE_LABEL)==0){
-            displayGraphic(text, FREEZE_BITMAP, FREEZE_WIDTH, FREEZE_HEIGHT);
-          } 
-          else if(strcmp(graphic, GAS_LABEL)==0){
-            displayGraphic(text, GAS_BITMAP, GAS_WIDTH, GAS_HEIGHT);
-          }               
-          else if(strcmp(graphic, WATER_LABEL)==0){
-            displayGraphic(text, WATER_BITMAP, WATER_WIDTH, WATER_HEIGHT);
-          }                                                 
-          else{ // default is INFO graphic if no match found
-            displayGraphic(text, INFO_BITMAP, INFO_WIDTH, INFO_HEIGHT);
-            // graphic = "INFO"
+          else{
+            displayGraphic(text, entry, mode);
           }
+          if(!display.scrolling()){ // a frame of scrolling text is only its first
+            displayFrameCacheStore(hash, op.value.length(), display.getBuffer());
+          }
+          showingDisplayCommand(hash, op.value.length());
           // TODO: Support refresh of display state. 
           // Record for state refresh
           // current_text = text;
@@ -772,6 +1146,87 @@ void processMessages(){
   
 }
 
+/*
+  Every incoming message arrives here first. Tone upload chunks are binary, and messageReceived() takes the payload as a
+  String that would end at the first zero byte, so they are handed to the tone upload as they are. So is the start of an
+  upload; neither publishes anything from inside the callback, as loop() reports the upload's progress.
+  Everything else goes to messageReceived() as before.
+*/
+void mqttMessageReceived(MQTTClient *client, char topic[], char bytes[], int length){
+  if(UPLOAD_CHUNK_TOPIC.compare(topic) == 0){
+    toneUploadChunk((const uint8_t *)bytes, length);
+    return;
+  }
+  if(UPLOAD_BEGIN_TOPIC.compare(topic) == 0){
+    Sprint(F("Incoming message: ")); Sprint(topic); Sprint(F(" : ")); Sprintln(bytes);
+    StaticJsonDocument<256> doc;
+    DeserializationError error = deserializeJson(doc, bytes, length);
+    if(error){
+      Sprint(F("Failed to parse upload: ")); Sprintln(error.c_str());
+      return;
+    }
+    tone_upload_kind kind = strcmp(doc["kind"] | "tone", "graphic") == 0 ? TONE_UPLOAD_GRAPHIC : TONE_UPLOAD_TONE;
+    toneUploadBegin(doc["name"] | "", doc["size"] | (uint32_t)0, doc["crc"] | (uint32_t)0, doc["chunk"] | (uint32_t)TONE_UPLOAD_CHUNK, kind);
+    return;
+  }
+  String str_topic = String(topic);
+  String str_payload = String(bytes); // terminated by the MQTT library
+  messageReceived(str_topic, str_payload);
+}
+
+/*
+  A newly uploaded tone only becomes playable, and selectable in Home Assistant, once it is in the tone index and the
+  siren's discovery message (available_tones) has been published again.
+*/
+void onToneUploaded(const char *name){
+  toneCacheForget(toneFilename(name).c_str()); // an older version of a replaced tone
+  toneIndexRefresh();
+
+  discovery_config_metadata_list = getAllDiscoveryConfigMessagesMetadata();
+  getAllSubscriptionTopics(std::string(DEVICE_ID)); // fills in default setter/getter topics again; they are already subscribed
+  publishDiscoveryMessages();
+}
+
+/*
+  A newly uploaded graphic can be used by display commands at once. Frames drawn with an older version of it are dropped,
+  and the screen is drawn again by the next display command even if it repeats the one on screen.
+*/
+void onGraphicUploaded(const char *name){
+  graphicStoreInstalled(name);
+  displayFrameCacheClear();
+  shown_display_len = -1;
+}
+
+/*
+  Moves a finished upload into the tones (or graphics) directory while nothing is playing, and tells the sender how the upload is going:
+  where to continue after a dropped chunk, how much is on the card, and whether it is complete.
+*/
+void processToneUpload(){
+  tone_upload_status status;
+  bool installed = !audioIsPlaying() && toneUploadInstall();
+  bool report = toneUploadPoll(status);
+  if(installed && status.kind == TONE_UPLOAD_GRAPHIC){
+    onGraphicUploaded(status.name);
+  }
+  else if(installed){
+    onToneUploaded(status.name); // before the sender hears it is complete
+  }
+  if(report){
+    std::string payload = "{\
+\"name\": \""+std::string(status.name)+"\", \
+\"state\": \""+std::string(toneUploadStateName(status.state))+"\", \
+\"size\": "+to_string((int)status.size)+", \
+\"next_seq\": "+to_string((int)status.next_seq)+", \
+\"written\": "+to_string((int)status.written)+", \
+\"dropped\": "+to_string((int)status.dropped)+", \
+\"elapsed_ms\": "+to_string((int)status.elapsed_ms)+", \
+\"error\": \""+std::string(status.error)+"\" \
+}";
+    // not logged; during an upload this is sent every few chunks
+    mqttclient.publish(UPLOAD_STATUS_TOPIC.c_str(), payload.c_str(), NOT_RETAINED, QOS_0);
+  }
+}
+
 void publish(){
     publishOnline(AVAILABILITY_TOPIC.c_str());
     //publishSensorData();    
@@ -785,7 +1240,7 @@ bool onMQTTConnect(){
   displayClear(); // erase any wifi offline or broker disconnected displayed messages
   //print_heap();
 
-  if(subscribeTopics(getAllSubscriptionTopics(std::string(DEVICE_ID)))){  
+  if(subscribeTopics(getAllSubscriptionTopics(std::string(DEVICE_ID))) && subscribeTopic(UPLOAD_BEGIN_TOPIC) && subscribeTopic(UPLOAD_CHUNK_TOPIC)){  
     // Must successfully publish all discovery messages before proceding 
     int discovery_messages_pending_publication;
     do {
@@ -866,6 +1321,7 @@ void assertMQTTConnectivity(){
 
   if(!mqtt_initialized){
     initMQTTClient(LOCAL_ENV_MQTT_BROKER_HOST, LOCAL_ENV_MQTT_BROKER_PORT, AVAILABILITY_TOPIC.c_str());          
+    mqttclient.onMessageAdvanced(mqttMessageReceived); // takes over from messageReceived(); tone upload chunks are binary
     mqtt_initialized = true;
     mqttclient.disconnect();  // necessary after init?       
     delay(100); // yield to allow for mqtt client activity post initialization    
@@ -980,22 +1436,35 @@ void initPlayer(){
   }
   Sprintln(F("VS1053 found"));
 
+  // from here on the SD card and the codec take turns on the SPI bus through the scheduler
+  if(!initSpiBus(VS1053_DCS)){
+    Sprintln(F("Failed to start SPI bus scheduler!"));
+    pixels.setPixelColor(0, pixels.Color(255, 0, 0)); // red
+    pixels.show();
+    displayBroken("Failed to start SPI bus!");
+    restart(); // there is a delay before reset
+  }
+
   /*
     Enabling the use of interrupts is successful, BUT as soon as audio is played, a device reset occurs! (with both play full and start playing)
+    The library's interrupt handler feeds the codec from ISR context. Background playback is instead done by the audio task
+    (see initAudioPlayer() below), which the DREQ interrupt merely wakes up.
   */
-  // If DREQ is on an interrupt pin we can do background audio playing (all ESP32 GPIO pins are interrupt-capable pins)
   //if(musicPlayer.useInterrupt(VS1053_FILEPLAYER_PIN_INT)){
-  // if(false){
-  //   Sprintln(F("Interrupt use enabled"));
-  // }    
-  // else{
-  //   Sprintln(F("Failed to enable interrupt use!"));
-  // }
 
   //Sprintln(F("Activating test tone...")); 
   //musicPlayer.sineTest(0x44, 500);    // Make a tone to indicate VS1053 is working
   
-  if(!SD.begin(CARDCS)) {
+  // Not fatal; critical tones in flash still play without the SD card (see partitions.csv)
+  if(initToneStore()){
+    Sprint(F("Tone store used: ")); Sprint(toneStoreUsed()); Sprint(F(" of ")); Sprintln(toneStoreCapacity());
+  }
+
+  bool sd_present = SD.begin(CARDCS, SPI, SPI_BUS_SD_HZ);
+  if(!sd_present && toneStoreCount() > 0) {
+    Sprintln(F("SD failed, or not present; only tones in flash will play"));
+  }
+  else if(!sd_present) {
     Sprintln(F("SD failed, or not present"));
     pixels.setPixelColor(0, pixels.Color(255, 0, 0)); // red
     pixels.show();
@@ -1008,6 +1477,55 @@ void initPlayer(){
     printDirectory(SD.open("/"), 0);  
     #endif
   }
+
+  // If DREQ is on an interrupt pin we can do background audio playing (all ESP32 GPIO pins are interrupt-capable pins)
+  if(initAudioPlayer(VS1053_DREQ, AUDIO_READAHEAD_SIZE)){
+    Sprintln(F("Audio task started"));
+  }
+  else{
+    Sprintln(F("Failed to start audio task!"));
+    pixels.setPixelColor(0, pixels.Color(255, 0, 0)); // red
+    pixels.show();
+    displayBroken("Failed to start audio task!");
+    restart(); // there is a delay before reset
+  }
+
+  // Not fatal; without PSRAM only tones on the SD card can be played. Before the tone cache claims its share of PSRAM.
+  if(!initAudioStream(AUDIO_STREAM_BUFFER_SIZE)){
+    Sprintln(F("Streaming disabled"));
+  }
+
+  // Not fatal; an index that cannot be saved is simply rebuilt at next boot
+  if(sd_present && !initToneIndex(TONE_DIR, TONE_INDEX_FILE)){
+    Sprintln(F("Failed to index tones!"));
+  }
+
+  // Not fatal; tones can still be copied onto the SD card by hand
+  static const tone_upload_graphics upload_graphics = { GRAPHIC_DIR, graphicStoreCheckName, graphicStoreCheckHeader };
+  if(sd_present && !initToneUpload(TONE_DIR, &upload_graphics)){
+    Sprintln(F("Failed to start tone upload!"));
+  }
+
+  // Not fatal; display commands can still use the graphics in graphics.h
+  if(sd_present && !initGraphicStore(GRAPHIC_DIR, GRAPHIC_STORE_BUDGET)){
+    Sprintln(F("Uploaded graphics unavailable"));
+  }
+
+  // Not fatal; without PSRAM every tone is simply played from the SD card. Last of the PSRAM users set up at boot, so
+  // the cache is sized from what they left.
+  size_t free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  size_t cache_budget = free_psram > PSRAM_RESERVE ? min((size_t)TONE_CACHE_BUDGET, free_psram - PSRAM_RESERVE) : 0;
+  if(initToneCache(cache_budget) && TONE_CACHE_PRELOAD){
+    std::vector<std::string> tones = availableTones();
+    for(int i=0;i < tones.size(); i++){
+      const uint8_t *stored;
+      size_t stored_size;
+      if(!toneStoreFind(tones.at(i).c_str(), &stored, &stored_size)){ // already in memory
+        toneCacheLoad(toneFilename(tones.at(i).c_str()).c_str());
+      }
+    }
+    Sprint(F("Tone cache used: ")); Sprintln(toneCacheUsed());
+  }
 }
 
 
@@ -1019,8 +1537,14 @@ void initDisplay(){
     restart();
   }
   else{
-    display.clearDisplay();
-    display.display();
+    displayClear(); // the whole frame, as the panel's contents are unknown
+    display.setGlyphs(GLYPH_ATLAS, GLYPH_ATLAS_COUNT);
+    if(!initDisplayFrameCache(DISPLAY_FRAME_CACHE_FRAMES, DISPLAY_WIDTH * DISPLAY_HEIGHT / 2)){
+      Sprintln(F("Display commands will be drawn every time"));
+    }
+    if(!display.startFlushTask()){
+      Sprintln(F("Display updates will block loop()"));
+    }
     Sprintln(F("Display initialized"));
   }
 }
@@ -1053,9 +1577,9 @@ void setup() {
   
   initBME280();
 
-  initPlayer();
+  initDisplay(); // its frame cache claims PSRAM before initPlayer() sizes the tone cache from what is left
 
-  initDisplay();
+  initPlayer();
 
   //displayMessage(2,"ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789!@#$%^&*()-+_=?[].");
   //displayMessage(1,"ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789_ABCDEFGHIJKLMNOPQRSTUVWXYZanbdefghijklmnopqrstuvwxyz0123456789");
@@ -1074,14 +1598,13 @@ unsigned long lastMillis = 0;
 bool lastPlayingState = false;
 void loop()
 {
-  if(musicPlayer.playingMusic) {
+  // the audio task feeds the codec; loop() only tracks the playing state
+  if(audioIsPlaying()) {
+    if(!lastPlayingState){ // just started playing
+      pixels.setPixelColor(0, pixels.Color(128, 128, 0)); // gold
+      pixels.show();
+    }
     lastPlayingState = true;
-    pixels.setPixelColor(0, pixels.Color(128, 128, 0)); // gold
-    pixels.show();    
-    musicPlayer.feedBuffer();
-    //Sprint(">");
-    pixels.clear();
-    pixels.show();    
   }
   else{
     if(lastPlayingState){ // just finished playing
@@ -1091,14 +1614,29 @@ void loop()
       std::string payload = "{\"state\": \""+OFF_VALUE+"\"}";
       publish(STATE_TOPIC.c_str(), payload.c_str());
 
+      pixels.clear();
+      pixels.show();
       lastPlayingState = false;
     }
+    // while idle, pull any tone that missed the cache into PSRAM so it starts from RAM next time
+    toneCacheLoadPending();
   }
   
   assertConnectivity(); // Blocks until network and MQTT broker connectivity established and all subscriptions successful
 
   mqttclient.loop(); // potential call to messageReceived()
   processMessages(); // deal with any pending_ops added by messageReceived() handler
+  processToneUpload(); // report progress of a tone upload; install it once complete and nothing is playing
+
+  // publish as soon as each playback ends, so a glitch can be lined up with wifi or broker activity at the time
+  while(audioPlaybackSummary(last_playback)){
+    if(last_playback.failed && !audioIsPlaying()){
+      // ON was published when the command was accepted, but it never started, so there is no end of playback to report OFF
+      std::string payload = "{\"state\": \""+OFF_VALUE+"\"}";
+      publish(STATE_TOPIC.c_str(), payload.c_str());
+    }
+    publishDiagnosticData();
+  }
     
   if (millis() - lastMillis > refresh_rate) {   
     lastMillis = millis();
@@ -0,0 +1,601 @@
+/*
+  Host-side simulator for the audio pipeline (pio run -e native, then .pio/build/native/program).
+
+  Runs the real audio player, tone index, tone cache and flash tone store against a simulated VS1053 that drains its FIFO
+  at the bit rate of the tone being played, and a simulated SD card that replays a latency profile. Each playable tone in
+  the tones directory is played once, in turn, while a stand-in for loop() blocks for as long as MQTT and display work
+  would on the board.
+  For every tone the time to first byte, codec underruns, the longest gap between writes to the codec, the share of the
+  time the SD card and the codec held the SPI bus and how often a codec write waited for it (see spi-bus.h) are reported,
+  along with the underruns the player itself counted and would publish (see audioPlaybackSummary()).
+  Time is simulated (see fakes/sim-clock.h), so a run takes a fraction of the tones' playing time and its results do not
+  depend on how busy the host is.
+
+  With --upload a tone is uploaded (see tone-upload.h) while the others play, paced as an MQTT sender on a local broker
+  would be, to show what the writer task costs the audio task and the throughput it sustains.
+
+  With --stream the first tone is played as an HTTP stream (see audio-stream.h) from a simulated server holding the same
+  files, and replaced by a stream of the second as soon as it has started, while its request is still waiting on the
+  server, as a new stream request replaces a playing one; the second must then play to its end.
+
+  With --sequence the two shortest WAV tones are played as one playlist, the first repeated twice and the second straight
+  after it, as a chime before an announcement is: the simulated codec follows WAV headers and data chunk lengths, so a
+  repeat that leaves the decoder expecting more data, and plays the next file as samples, is caught.
+
+  With --corrupt-tones WAVs whose chunk lengths are corrupt (as a bad copy or a hostile upload could leave them) are
+  put on the card before it is indexed: indexing them and asking the player for them must not hang, and they must not
+  be listed as playable.
+
+  Exits with 1 if any tone fails to play, or (with --fail-on-underrun) if any tone underruns, so it can gate CI.
+
+  Only the audio libraries are built: MQTT, the BME280 and the display are not simulated, and WiFi only as far as the
+  HTTP server streams are fetched from.
+*/
+#include <Arduino.h>
+#include <SD.h>
+#include <Adafruit_VS1053.h>
+#include "audio-player.h"
+#include "tone-index.h"
+#include "tone-cache.h"
+#include "tone-store.h"
+#include "tone-upload.h"
+#include "audio-stream.h"
+#include <HTTPClient.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+// as in include/chime.h
+#define VS1053_RESET   -1
+#define VS1053_CS       6
+#define VS1053_DCS     10
+#define CARDCS          5
+#define VS1053_DREQ     9
+#define TONE_DIR "/tones"
+#define TONE_INDEX_FILE "/tones.idx"
+#define AUDIO_READAHEAD_SIZE (16 * 1024)
+#define TONE_CACHE_BUDGET (1536 * 1024)
+#define TONE_STORE_SIZE 0xF0000       // as in partitions.csv
+#define AUDIO_STREAM_BUFFER_SIZE (256 * 1024)
+
+#define SIM_START_TIMEOUT_MS 1000     // from audioPlay() to the audio task reporting it is playing
+#define SIM_END_MARGIN_MS 5000        // allowed beyond twice the tone's own length before giving up on it
+#define SIM_UPLOAD_MARGIN_MS 10000    // allowed beyond the upload's own length at the sender's rate
+#define SIM_STREAM_CONNECT_MS 150     // simulated HTTP server's time to answer a request
+#define SIM_STREAM_URL "http://sim"   // any host reaches the simulated server
+
+Adafruit_VS1053_FilePlayer musicPlayer = Adafruit_VS1053_FilePlayer(VS1053_RESET, VS1053_CS, VS1053_DCS, VS1053_DREQ, CARDCS);
+
+struct sim_options{
+  const char *sd_root = "content";      // holds TONE_DIR
+  const char *profile = NULL;           // SD latency profile; built-in defaults if none
+  uint32_t loop_block_ms = 5;           // loop() time per pass not spent on the SD card (MQTT, display, publishing)
+  uint32_t loop_sd_ms = 0;              // loop() time per pass holding the SD card (as a tone upload or index refresh would)
+  size_t readahead = AUDIO_READAHEAD_SIZE;
+  uint32_t sd_hz = SPI_BUS_SD_HZ;       // SPI clock for the SD card
+  bool cache = false;                   // preload tones into the tone cache, as TONE_CACHE_PRELOAD does
+  const char *flash = NULL;             // flash tone store image (make-tone-store.py); tones in it are played from flash
+  int duration = 0;                     // seconds; loop each tone for this long instead of playing it once
+  const char *upload = NULL;            // tone file uploaded to the card while the others play
+  uint32_t upload_kbps = 100;           // KB/s the sender offers; what a local broker delivers to the board
+  bool stream = false;                  // replace a playing stream with another
+  uint32_t stream_kbps = 400;           // KB/s the simulated HTTP server sends at
+  bool corrupt_tones = false;           // add WAVs with corrupt chunk lengths to the card
+  bool sequence = false;                // play a repeated WAV followed by another
+  bool fail_on_underrun = false;
+};
+
+struct sim_result{
+  bool started = false;
+  bool finished = false;
+  sim_codec_stats codec;
+  audio_playback_stats player;          // as the player itself measured it; what the board publishes
+  uint32_t bus_waits = 0;               // codec writes that waited for the SPI bus
+  float sd_busy_pct = 0;                // share of the tone's time the SD card held the bus
+  float codec_busy_pct = 0;
+};
+
+// Stands in for test/siren/upload-tone.py on the other end of the broker
+struct sim_upload{
+  std::vector<uint8_t> data;
+  char name[TONE_INDEX_NAME_LEN] = "";
+  uint32_t crc = 0;
+  uint32_t next = 0;                    // next chunk to send
+  uint32_t dropped = 0;                 // as last reported
+  uint32_t window_base = 0;             // first chunk not known to be on the card
+  int64_t started_us = 0;
+  bool begun = false;
+  bool installed = false;
+  tone_upload_status status;
+};
+
+static sim_upload upload;
+
+static void usage(const char *program){
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  --sd-root DIR          host directory standing in for the SD card (default content)\n"
+    "  --profile FILE         SD card latency profile (see src/sim/profiles)\n"
+    "  --loop-block-ms N      loop() busy time per pass (default 5)\n"
+    "  --loop-sd-ms N         loop() SD card time per pass (default 0)\n"
+    "  --readahead BYTES      read-ahead buffer size (default %d)\n"
+    "  --sd-hz N              SD card SPI clock (default %d)\n"
+    "  --cache                play tones from the PSRAM tone cache\n"
+    "  --flash IMAGE          flash tone store image; tones in it are played from flash\n"
+    "  --duration S           loop each tone for S seconds instead of playing it once\n"
+    "  --upload FILE          upload FILE to the tones directory while the others play\n"
+    "  --upload-kbps N        KB/s the upload is sent at (default 100)\n"
+    "  --stream               stream the first tone, then replace it with a stream of the second\n"
+    "  --stream-kbps N        KB/s the simulated HTTP server sends at (default 400)\n"
+    "  --corrupt-tones        add WAVs with corrupt chunk lengths to the card, which must be refused\n"
+    "  --sequence             play the shortest WAV twice, then the next shortest, as one playlist\n"
+    "  --fail-on-underrun     exit 1 if any tone underruns\n",
+    program, AUDIO_READAHEAD_SIZE, SPI_BUS_SD_HZ);
+}
+
+static bool parseOptions(int argc, char **argv, sim_options &opt){
+  for(int i = 1; i < argc; i++){
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if(strcmp(arg, "--cache") == 0){
+      opt.cache = true;
+      continue;
+    }
+    if(strcmp(arg, "--fail-on-underrun") == 0){
+      opt.fail_on_underrun = true;
+      continue;
+    }
+    if(strcmp(arg, "--stream") == 0){
+      opt.stream = true;
+      continue;
+    }
+    if(strcmp(arg, "--corrupt-tones") == 0){
+      opt.corrupt_tones = true;
+      continue;
+    }
+    if(strcmp(arg, "--sequence") == 0){
+      opt.sequence = true;
+      continue;
+    }
+    if(value == NULL){
+      return false;
+    }
+    i++;
+    if(strcmp(arg, "--sd-root") == 0){
+      opt.sd_root = value;
+    }
+    else if(strcmp(arg, "--flash") == 0){
+      opt.flash = value;
+    }
+    else if(strcmp(arg, "--profile") == 0){
+      opt.profile = value;
+    }
+    else if(strcmp(arg, "--loop-block-ms") == 0){
+      opt.loop_block_ms = atoi(value);
+    }
+    else if(strcmp(arg, "--loop-sd-ms") == 0){
+      opt.loop_sd_ms = atoi(value);
+    }
+    else if(strcmp(arg, "--readahead") == 0){
+      opt.readahead = atoi(value);
+    }
+    else if(strcmp(arg, "--sd-hz") == 0){
+      opt.sd_hz = atoi(value);
+    }
+    else if(strcmp(arg, "--duration") == 0){
+      opt.duration = atoi(value);
+    }
+    else if(strcmp(arg, "--upload") == 0){
+      opt.upload = value;
+    }
+    else if(strcmp(arg, "--upload-kbps") == 0){
+      opt.upload_kbps = atoi(value);
+    }
+    else if(strcmp(arg, "--stream-kbps") == 0){
+      opt.stream_kbps = atoi(value);
+    }
+    else{
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool loadUpload(const char *path){
+  std::ifstream in(path, std::ios::binary);
+  upload.data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  const char *slash = strrchr(path, '/');
+  snprintf(upload.name, sizeof(upload.name), "upload-%s", slash != NULL ? slash + 1 : path);
+  upload.crc = crc32_le(0, upload.data.data(), upload.data.size());
+  return !upload.data.empty();
+}
+
+/*
+  What the sender and the MQTT callback do in one pass: send chunks as the rate allows, keeping no more than
+  TONE_UPLOAD_SLOTS of them beyond what the board has reported written, and go back to next_seq when it reports a drop.
+*/
+static void uploadOnce(const sim_options &opt){
+  if(upload.data.empty() || upload.installed){
+    return;
+  }
+  if(!upload.begun){
+    upload.begun = true;
+    upload.started_us = simMicros();
+    toneUploadBegin(upload.name, upload.data.size(), upload.crc, TONE_UPLOAD_CHUNK);
+  }
+  if(toneUploadPoll(upload.status)){
+    upload.window_base = upload.status.written / TONE_UPLOAD_CHUNK;
+    if(upload.status.state == TONE_UPLOAD_RECEIVING && (upload.status.dropped != upload.dropped || upload.next < upload.status.next_seq)){
+      upload.next = upload.status.next_seq;
+    }
+    upload.dropped = upload.status.dropped;
+  }
+  if(upload.status.state != TONE_UPLOAD_RECEIVING){
+    return;
+  }
+  uint32_t chunks = (upload.data.size() + TONE_UPLOAD_CHUNK - 1) / TONE_UPLOAD_CHUNK;
+  uint64_t offered = (uint64_t)(simMicros() - upload.started_us) * opt.upload_kbps * 1024 / 1000000;
+  uint8_t frame[sizeof(tone_upload_frame) + TONE_UPLOAD_CHUNK];
+  while(upload.next < chunks && upload.next < upload.window_base + TONE_UPLOAD_SLOTS && (uint64_t)upload.next * TONE_UPLOAD_CHUNK < offered){
+    uint32_t offset = upload.next * TONE_UPLOAD_CHUNK;
+    uint32_t len = min((uint32_t)TONE_UPLOAD_CHUNK, (uint32_t)upload.data.size() - offset);
+    tone_upload_frame header;
+    header.upload_id = upload.crc;
+    header.seq = upload.next;
+    header.checksum = crc32_le(0, upload.data.data() + offset, len);
+    memcpy(frame, &header, sizeof(header));
+    memcpy(frame + sizeof(header), upload.data.data() + offset, len);
+    toneUploadChunk(frame, sizeof(header) + len);
+    upload.next++;
+  }
+}
+
+// Between tones, as loop() does once nothing is playing
+static void installUpload(){
+  if(toneUploadInstall()){
+    char path[AUDIO_PATH_LEN];
+    snprintf(path, sizeof(path), "%s/%s", TONE_DIR, upload.name);
+    toneCacheForget(path);
+    toneIndexRefresh();
+    upload.installed = true;
+  }
+}
+
+// One pass of the board's loop() as far as the audio pipeline can tell
+static void loopOnce(const sim_options &opt){
+  if(!audioIsPlaying()){
+    toneCacheLoadPending();
+  }
+  uploadOnce(opt);
+  if(opt.loop_sd_ms > 0){
+    audioLock();
+    simBusHold((int64_t)opt.loop_sd_ms * 1000);
+    audioUnlock();
+  }
+  delay(max(opt.loop_block_ms, (uint32_t)1));
+}
+
+static bool waitFor(const sim_options &opt, bool playing, uint32_t timeout_ms){
+  unsigned long started = millis();
+  while(audioIsPlaying() != playing){
+    if(millis() - started > timeout_ms){
+      return false;
+    }
+    loopOnce(opt);
+  }
+  return true;
+}
+
+static sim_result playTone(const sim_options &opt, const tone_record &rec){
+  sim_result result;
+  audio_playlist playlist;
+  audio_entry &entry = playlist.entries[0];
+  snprintf(entry.path, AUDIO_PATH_LEN, "%s/%s", TONE_DIR, rec.name);
+  entry.data_offset = rec.data_offset;
+  entry.wav_length_field = rec.wav_length_field;
+  entry.repeat = opt.duration > 0 ? 0 : 1;
+  playlist.count = 1;
+  playlist.duration_ms = opt.duration > 0 ? opt.duration * 1000 : 0;
+
+  spi_device_usage sd = spiBusUsage(SPI_DEVICE_SD);
+  spi_device_usage codec = spiBusUsage(SPI_DEVICE_CODEC_DATA);
+  int64_t started_us = simMicros();
+  simCodecReset((uint64_t)rec.size * 1000 / rec.duration_ms);
+  result.started = audioPlay(playlist) && waitFor(opt, true, SIM_START_TIMEOUT_MS);
+  if(!result.started){
+    return result;
+  }
+  uint32_t length_ms = opt.duration > 0 ? opt.duration * 1000 : rec.duration_ms;
+  result.finished = waitFor(opt, false, 2 * length_ms + SIM_END_MARGIN_MS);
+  if(!result.finished){
+    audioStop();
+    waitFor(opt, false, SIM_START_TIMEOUT_MS);
+  }
+  result.codec = simCodecStats();
+  result.bus_waits = spiBusUsage(SPI_DEVICE_CODEC_DATA).waits - codec.waits;
+  float elapsed_us = max(simMicros() - started_us, (int64_t)1);
+  result.sd_busy_pct = 100 * (spiBusUsage(SPI_DEVICE_SD).busy_us - sd.busy_us) / elapsed_us;
+  result.codec_busy_pct = 100 * (spiBusUsage(SPI_DEVICE_CODEC_DATA).busy_us - codec.busy_us) / elapsed_us;
+  while(audioPlaybackSummary(result.player)){
+    // keep the last; earlier ones were for playlists that did not start
+  }
+
+  // let the codec play out the end of the tone before the next measurement starts
+  while(simCodecFifoLevel() > 0){
+    delay(1);
+  }
+  return result;
+}
+
+/*
+  A WAV entry repeated, then another WAV gaplessly behind it: the codec must see both files, each ending where its data
+  chunk says, with all of their audio decoded as samples. True if it did.
+*/
+static bool playSequence(const sim_options &opt, const tone_record &first, const tone_record &second){
+  const uint16_t FIRST_PLAYS = 2;
+  audio_playlist playlist;
+  const tone_record *recs[2] = { &first, &second };
+  for(int i = 0; i < 2; i++){
+    audio_entry &entry = playlist.entries[i];
+    snprintf(entry.path, AUDIO_PATH_LEN, "%s/%s", TONE_DIR, recs[i]->name);
+    entry.data_offset = recs[i]->data_offset;
+    entry.wav_length_field = recs[i]->wav_length_field;
+    entry.repeat = i == 0 ? FIRST_PLAYS : 1;
+  }
+  playlist.count = 2;
+
+  simCodecReset((uint64_t)first.size * 1000 / first.duration_ms);
+  uint32_t length_ms = FIRST_PLAYS * first.duration_ms + second.duration_ms;
+  bool played = audioPlay(playlist) && waitFor(opt, true, SIM_START_TIMEOUT_MS) && waitFor(opt, false, 2 * length_ms + SIM_END_MARGIN_MS);
+  sim_codec_stats codec = simCodecStats();
+  uint64_t samples = (uint64_t)FIRST_PLAYS * (first.size - first.data_offset) + (second.size - second.data_offset);
+  printf("\nsequence %s x%u then %s: %s, %u of 2 WAV files decoded, %llu of %llu sample bytes%s\n", first.name, FIRST_PLAYS,
+    second.name, played ? "played" : "TIMED OUT", codec.wav_files, (unsigned long long)codec.wav_samples,
+    (unsigned long long)samples, codec.wav_open ? ", the decoder still EXPECTS MORE" : "");
+  while(simCodecFifoLevel() > 0){
+    delay(1);
+  }
+  return played && codec.wav_files == 2 && codec.wav_samples == samples && !codec.wav_open;
+}
+
+// chunk lengths that take a 32 bit position back to the same chunk, or before it, unless checked
+static const uint32_t CORRUPT_CHUNK_LENGTHS[] = { 0xFFFFFFF8, 0xFFFFFFF7, 0xFFFFFFF0 };
+#define CORRUPT_TONE_COUNT (sizeof(CORRUPT_CHUNK_LENGTHS) / sizeof(CORRUPT_CHUNK_LENGTHS[0]))
+
+static void corruptToneName(char *name, size_t i){
+  snprintf(name, TONE_INDEX_NAME_LEN, "corrupt-%u.wav", (unsigned)i);
+}
+
+// Written to the simulated card only: a LIST chunk of that length where the fmt chunk would be, then 512 bytes of "audio"
+static void writeCorruptTones(){
+  for(size_t i = 0; i < CORRUPT_TONE_COUNT; i++){
+    uint8_t wav[44 + 512] = {};
+    uint32_t riff_len = sizeof(wav) - 8;
+    memcpy(wav, "RIFF", 4);
+    memcpy(wav + 4, &riff_len, 4);
+    memcpy(wav + 8, "WAVELIST", 8);
+    memcpy(wav + 16, &CORRUPT_CHUNK_LENGTHS[i], 4);
+    char name[TONE_INDEX_NAME_LEN];
+    corruptToneName(name, i);
+    char path[AUDIO_PATH_LEN];
+    snprintf(path, sizeof(path), "%s/%s", TONE_DIR, name);
+    File f = SD.open(path, FILE_WRITE);
+    f.write(wav, sizeof(wav));
+    f.close();
+  }
+}
+
+/*
+  Once indexed (which has to have returned to get here): each corrupt tone must have no duration, so it is not
+  offered, and playing it anyway must end. True if so.
+*/
+static bool checkCorruptTones(const sim_options &opt){
+  bool ok = true;
+  for(size_t i = 0; i < CORRUPT_TONE_COUNT; i++){
+    char name[TONE_INDEX_NAME_LEN];
+    corruptToneName(name, i);
+    const tone_record *rec = toneIndexFind(name);
+    char path[AUDIO_PATH_LEN];
+    snprintf(path, sizeof(path), "%s/%s", TONE_DIR, name);
+    simCodecReset(176400);
+    bool ended = audioPlay(path, 0) && waitFor(opt, false, SIM_START_TIMEOUT_MS + SIM_END_MARGIN_MS);
+    audio_playback_stats summary;
+    while(audioPlaybackSummary(summary)){
+      // only the player carrying on matters here
+    }
+    bool refused = rec == NULL || rec->duration_ms == 0;
+    printf("%s chunk length 0x%08X: %s, %s\n", name, CORRUPT_CHUNK_LENGTHS[i], refused ? "not offered" : "OFFERED as playable",
+      ended ? "player carried on" : "player STUCK");
+    ok = ok && refused && ended;
+  }
+  return ok;
+}
+
+static void streamPlaylist(audio_playlist &playlist, char *url, const tone_record &rec){
+  playlist.entries[0].stream = true;
+  playlist.entries[0].repeat = 1;
+  playlist.count = 1;
+  snprintf(url, AUDIO_URL_LEN, "%s%s/%s", SIM_STREAM_URL, TONE_DIR, rec.name);
+}
+
+/*
+  A stream request arriving while another stream plays: the first stream is replaced as soon as the player has started
+  it, with its download still blocked on the server's response, and the second must play to its end. True if it did.
+*/
+static bool streamReplace(const sim_options &opt, const tone_record &first, const tone_record &second){
+  audio_playlist playlist;
+  char url[AUDIO_URL_LEN];
+  char second_url[AUDIO_URL_LEN];
+  streamPlaylist(playlist, url, first);
+  simCodecReset((uint64_t)first.size * 1000 / first.duration_ms);
+  if(!audioPlay(playlist, url) || !waitFor(opt, true, SIM_START_TIMEOUT_MS)){
+    printf("stream %s: FAILED to start\n", first.name);
+    return false;
+  }
+
+  streamPlaylist(playlist, second_url, second);
+  simCodecReset((uint64_t)second.size * 1000 / second.duration_ms);
+  audioPlay(playlist, second_url);
+  audio_playback_stats last;
+  bool ended = false;
+  unsigned long started = millis();
+  while(!ended && millis() - started < 2 * second.duration_ms + SIM_END_MARGIN_MS){
+    loopOnce(opt);
+    // the first stream's summary comes first
+    while(audioPlaybackSummary(last)){
+      ended = strncmp(last.source, second_url, AUDIO_PATH_LEN - 1) == 0;
+    }
+  }
+  sim_codec_stats codec = simCodecStats();
+  float ttfb_ms = codec.first_byte_us >= 0 ? (codec.first_byte_us - codec.started_us) / 1000.0 : 0;
+  printf("\nstream %s replaced by %s: %s, %u bytes (of %u), %u underruns, ttfb %.1f ms\n", first.name, second.name,
+    !ended ? "TIMED OUT" : last.failed ? "FAILED" : last.stopped ? "stopped" : "played",
+    last.bytes, second.size, codec.underruns, ttfb_ms);
+  return ended && !last.failed && !last.stopped && last.bytes >= second.size;
+}
+
+int main(int argc, char **argv){
+  sim_options opt;
+  if(!parseOptions(argc, argv, opt)){
+    usage(argv[0]);
+    return 2;
+  }
+  simSdSetRoot(opt.sd_root);
+  if(opt.profile != NULL && !simSdLoadProfile(opt.profile)){
+    fprintf(stderr, "Invalid SD latency profile: %s\n", opt.profile);
+    return 2;
+  }
+
+  if(opt.flash != NULL && (!simFlashLoadImage(opt.flash, TONE_STORE_PARTITION, TONE_STORE_SUBTYPE, TONE_STORE_SIZE) || !initToneStore())){
+    fprintf(stderr, "Invalid tone store image: %s\n", opt.flash);
+    return 2;
+  }
+  if(!musicPlayer.begin() || !initSpiBus(VS1053_DCS) || !SD.begin(CARDCS, SPI, opt.sd_hz)
+    || !initAudioPlayer(VS1053_DREQ, opt.readahead)){
+    fprintf(stderr, "Failed to start audio pipeline (is %s a directory?)\n", opt.sd_root);
+    return 2;
+  }
+  if(opt.corrupt_tones){
+    writeCorruptTones();
+  }
+  if(!initToneIndex(TONE_DIR, TONE_INDEX_FILE)){
+    fprintf(stderr, "Failed to index %s%s\n", opt.sd_root, TONE_DIR);
+    return 2;
+  }
+  if(opt.upload != NULL && (!loadUpload(opt.upload) || !initToneUpload(TONE_DIR))){
+    fprintf(stderr, "Failed to start upload of %s\n", opt.upload);
+    return 2;
+  }
+  if(opt.stream){
+    simHttpServe(opt.sd_root, opt.stream_kbps * 1024, SIM_STREAM_CONNECT_MS);
+    if(!initAudioStream(AUDIO_STREAM_BUFFER_SIZE)){
+      fprintf(stderr, "Failed to start stream task\n");
+      return 2;
+    }
+  }
+  if(opt.cache && initToneCache(TONE_CACHE_BUDGET)){
+    for(size_t i = 0; i < toneIndexCount(); i++){
+      char path[AUDIO_PATH_LEN];
+      snprintf(path, sizeof(path), "%s/%s", TONE_DIR, toneIndexAt(i)->name);
+      toneCacheLoad(path);
+    }
+  }
+
+  printf("%-24s %-5s %9s %7s %8s %9s %10s %12s %9s %8s %11s %9s\n",
+    "tone", "codec", "bytes", "kbit/s", "ttfb_ms", "underruns", "starved_ms", "worst_gap_ms", "bus_waits", "sd_busy%", "codec_busy%", "reported");
+  int failed = 0;
+  int underran = 0;
+  // an upload refreshes the index part way through
+  std::vector<tone_record> tones(toneIndexAt(0), toneIndexAt(0) + toneIndexCount());
+  for(size_t i = 0; i < tones.size(); i++){
+    const tone_record *rec = &tones[i];
+    if(toneIndexFind(rec->name) == NULL || rec->duration_ms == 0){
+      printf("%-24s %-5s skipped (%s)\n", rec->name, toneCodecName(rec->codec),
+        rec->codec == TONE_CODEC_UNKNOWN ? "not a tone" : "unknown duration");
+      continue;
+    }
+    sim_result r = playTone(opt, *rec);
+    installUpload();
+    uint32_t kbps = (uint64_t)rec->size * 8 / rec->duration_ms;
+    if(!r.started){
+      printf("%-24s %-5s %9u %7u FAILED to start\n", rec->name, toneCodecName(rec->codec), rec->size, kbps);
+      failed++;
+      continue;
+    }
+    printf("%-24s %-5s %9llu %7u %8.1f %9u %10.1f %12.1f %9u %8.1f %11.1f %9u%s\n", rec->name, toneCodecName(rec->codec),
+      (unsigned long long)r.codec.bytes, kbps,
+      (r.codec.first_byte_us - r.codec.started_us) / 1000.0, r.codec.underruns, r.codec.starved_us / 1000.0,
+      r.codec.worst_feed_gap_us / 1000.0, r.bus_waits, r.sd_busy_pct, r.codec_busy_pct, r.player.underruns,
+      r.finished ? "" : " TIMED OUT");
+    if(!r.finished){
+      failed++;
+    }
+    if(r.codec.underruns > 0){
+      underran++;
+    }
+  }
+
+  if(opt.sequence){
+    std::vector<const tone_record *> wavs;
+    for(const tone_record &rec : tones){
+      if(rec.codec == TONE_CODEC_WAV && rec.duration_ms > 0 && toneIndexFind(rec.name) != NULL){
+        wavs.push_back(&rec);
+      }
+    }
+    std::sort(wavs.begin(), wavs.end(), [](const tone_record *a, const tone_record *b){ return a->size < b->size; });
+    if(wavs.size() < 2){
+      printf("\nsequence: skipped (needs two playable WAV tones)\n");
+    }
+    else if(!playSequence(opt, *wavs[0], *wavs[1])){
+      failed++;
+    }
+  }
+
+  if(opt.corrupt_tones){
+    printf("\n");
+    if(!checkCorruptTones(opt)){
+      failed++;
+    }
+  }
+
+  if(opt.stream){
+    std::vector<const tone_record *> playable;
+    for(const tone_record &rec : tones){
+      if(rec.duration_ms > 0 && toneIndexFind(rec.name) != NULL){
+        playable.push_back(&rec);
+      }
+    }
+    if(playable.size() < 2){
+      printf("\nstream: skipped (needs two playable tones)\n");
+    }
+    else if(!streamReplace(opt, *playable[0], *playable[1])){
+      failed++;
+    }
+  }
+
+  if(!upload.data.empty()){
+    uint32_t length_ms = (uint64_t)upload.data.size() * 1000 / (opt.upload_kbps * 1024);
+    unsigned long started = millis();
+    while(!upload.installed && upload.status.state != TONE_UPLOAD_FAILED && millis() - started < length_ms + SIM_UPLOAD_MARGIN_MS){
+      loopOnce(opt);
+      installUpload();
+    }
+    toneUploadPoll(upload.status);
+    bool indexed = upload.installed && toneIndexFind(upload.name) != NULL;
+    float elapsed_s = max(upload.status.elapsed_ms, (uint32_t)1) / 1000.0;
+    printf("\nupload %s: %s%s, %u bytes in %.2fs (%.1f KB/s offered %u), %u chunks dropped\n", upload.name,
+      toneUploadStateName(upload.status.state), indexed ? " and indexed" : "", upload.status.written, elapsed_s,
+      upload.status.written / 1024.0 / elapsed_s, opt.upload_kbps, upload.status.dropped);
+    if(!indexed){
+      failed++;
+    }
+  }
+  fflush(stdout);
+
+  // detached task and timer threads are still running; skip static destructors
+  if(failed > 0 || (opt.fail_on_underrun && underran > 0)){
+    _exit(1);
+  }
+  _exit(0);
+}
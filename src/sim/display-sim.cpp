@@ -0,0 +1,377 @@
+/*
+  Host-side renderer for the display (pio run -e display, then .pio/build/display/program).
+
+  Draws every screen the chime can show with the real DisplayPanel and display-screens.cpp into a simulated SSD1327 (see
+  fakes/Adafruit_SSD1327.h): each label in graphics.h (text styles with a sample sentence at their text size, icons
+  with a message under them), the status screens and a titled screen. Each screen is flushed to the panel from a blank
+  one, as after clearDisplay(), and what the panel then shows is compared with a golden image, an 8 bit greyscale PNG
+  per screen in the golden directory; a flush that leaves the panel different from the frame buffer fails too.
+  Then, with the flush task running, an icon with more text under it than fits is drawn once scrolling a page at a time
+  and once as a marquee: each is left for its first pause and one step of the scroll timer, and the panel compared then.
+
+  For every screen the host time to draw it (averaged over --repeat runs, useful only to compare one build with another)
+  and what its flush would cost on the board are reported: bytes, windows and rows sent, and the time the I2C transfer
+  takes at the display's 1MHz clock (simulated; see fakes/sim-clock.h).
+
+  --update-golden writes the golden images instead of comparing with them, after a change that is meant to alter what is
+  drawn; --out writes what was drawn, whether or not it matched, to look at. Exits with 1 if any screen differs from its
+  golden image or has none, so it can gate CI.
+
+  Text is drawn from include/glyphs.h, which make-glyphs.py generates from Adafruit GFX's font and which is committed
+  with the golden images: images recorded with the anti-aliased atlas do not match one generated with --no-aa. The still
+  screens are drawn without the flush task, so text that does not fit them is drawn as its first page rather than
+  scrolled.
+*/
+#include <Arduino.h>
+#include <Adafruit_SSD1327.h>
+#include "display-panel.h"
+#include "display-screens.h"
+#include "graphics.h"
+#include "glyphs.h"
+#include <sys/stat.h>
+#include <zlib.h>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+// as in include/chime.h and src/chime.cpp
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 128
+#define DISPLAY_I2C_HZ 1000000
+
+#define SIM_SCROLL_TIMEOUT_MS (DISPLAY_SCROLL_PAUSE_MS + 1000)  // for a scrolling screen's first step to reach the panel
+
+#define SIM_TEXT_SAMPLE_1 "Front door opened at 07:42 and closed again. Garage door ajar for 15 minutes; back door locked. " \
+                          "Outside 21.5C, 48% humidity, 1013hPa. AQI 42 (good), CO2 612ppm."
+#define SIM_TEXT_SAMPLE_2 "Garage door ajar for 15 min. 21.5C, 48%"
+#define SIM_TEXT_SAMPLE_3 "Door bell! 21.5C"
+#define SIM_ICON_SAMPLE "Smoke detected in the kitchen at 07:42. Leave the house and call 911."
+
+struct sim_options{
+  const char *golden = "test/display/golden";
+  const char *out = NULL;               // directory for what was drawn, as PNGs
+  bool update_golden = false;
+  int repeat = 100;                     // draws of each screen timed
+};
+
+struct sim_screen{
+  std::string name;                     // of its PNG, without the extension
+  std::function<void(DisplayPanel &)> draw;
+  bool scrolls = false;                 // drawn with the flush task, and compared after one step of scrolling
+};
+
+static void usage(const char *program){
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  --golden DIR           golden images (default test/display/golden)\n"
+    "  --update-golden        write the golden images instead of comparing with them\n"
+    "  --out DIR              also write every screen drawn, as a PNG\n"
+    "  --repeat N             draws of each screen timed (default 100)\n",
+    program);
+}
+
+static bool parseOptions(int argc, char **argv, sim_options &opt){
+  for(int i = 1; i < argc; i++){
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if(strcmp(arg, "--update-golden") == 0){
+      opt.update_golden = true;
+      continue;
+    }
+    if(value == NULL){
+      return false;
+    }
+    if(strcmp(arg, "--golden") == 0){
+      opt.golden = value;
+    }
+    else if(strcmp(arg, "--out") == 0){
+      opt.out = value;
+    }
+    else if(strcmp(arg, "--repeat") == 0 && atoi(value) > 0){
+      opt.repeat = atoi(value);
+    }
+    else{
+      return false;
+    }
+    i++;
+  }
+  return true;
+}
+
+static std::vector<sim_screen> screens(){
+  std::vector<sim_screen> list;
+  for(size_t i = 0; i < GRAPHICS_COUNT; i++){
+    const graphic_entry *g = &GRAPHICS[i];
+    std::string name = g->label;
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+    if(g->style == GRAPHIC_TEXT){
+      const char *sample = g->text_size == 1 ? SIM_TEXT_SAMPLE_1 : g->text_size == 2 ? SIM_TEXT_SAMPLE_2 : SIM_TEXT_SAMPLE_3;
+      list.push_back({ name, [g, sample](DisplayPanel &p){ drawTextScreen(p, g->text_size, sample); } });
+    }
+    else{
+      list.push_back({ name, [g](DisplayPanel &p){ drawGraphicScreen(p, SIM_ICON_SAMPLE, g->bitmap, g->depth, g->width, g->height); } });
+    }
+  }
+  // as displayWifiOffline(), displayMQTTOffline() and displayBroken() in src/chime.cpp
+  list.push_back({ "status-wifi", [](DisplayPanel &p){ drawGraphicScreen(p, "Unable to connect to network!", WIFI_ALERT_GRAPHIC.bitmap,
+    WIFI_ALERT_GRAPHIC.depth, WIFI_ALERT_GRAPHIC.width, WIFI_ALERT_GRAPHIC.height); } });
+  list.push_back({ "status-mqtt", [](DisplayPanel &p){ drawGraphicScreen(p, "Unable to connect to MQTT broker!", MQTT_ALERT_GRAPHIC.bitmap,
+    MQTT_ALERT_GRAPHIC.depth, MQTT_ALERT_GRAPHIC.width, MQTT_ALERT_GRAPHIC.height); } });
+  list.push_back({ "status-broken", [](DisplayPanel &p){ drawGraphicScreen(p, "Failed to access SDcard!", BROKEN_GRAPHIC.bitmap,
+    BROKEN_GRAPHIC.depth, BROKEN_GRAPHIC.width, BROKEN_GRAPHIC.height); } });
+  list.push_back({ "titled", [](DisplayPanel &p){ drawTitledScreen(p, "DIAGNOSTIC", SIM_TEXT_SAMPLE_1); } });
+  // last: they need the flush task
+  list.push_back({ "scroll-pages", [](DisplayPanel &p){ drawGraphicScreen(p, SIM_TEXT_SAMPLE_1, BROKEN_GRAPHIC.bitmap,
+    BROKEN_GRAPHIC.depth, BROKEN_GRAPHIC.width, BROKEN_GRAPHIC.height, DISPLAY_SCROLL_PAGES); }, true });
+  list.push_back({ "scroll-marquee", [](DisplayPanel &p){ drawGraphicScreen(p, SIM_TEXT_SAMPLE_1, BROKEN_GRAPHIC.bitmap,
+    BROKEN_GRAPHIC.depth, BROKEN_GRAPHIC.width, BROKEN_GRAPHIC.height, DISPLAY_SCROLL_MARQUEE); }, true });
+  return list;
+}
+
+static void putChunk(std::vector<uint8_t> &png, const char *type, const std::vector<uint8_t> &data){
+  uint32_t len = data.size();
+  uint8_t head[8] = { (uint8_t)(len >> 24), (uint8_t)(len >> 16), (uint8_t)(len >> 8), (uint8_t)len };
+  memcpy(head + 4, type, 4);
+  png.insert(png.end(), head, head + 8);
+  png.insert(png.end(), data.begin(), data.end());
+  uint32_t crc = crc32(0, head + 4, 4);
+  if(!data.empty()){ // crc32() of a NULL buffer is its initial value, not a checksum
+    crc = crc32(crc, data.data(), data.size());
+  }
+  uint8_t tail[4] = { (uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc };
+  png.insert(png.end(), tail, tail + 4);
+}
+
+static uint32_t be32(const uint8_t *p){
+  return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+// 4 bit frame (the buffer's layout) as an 8 bit greyscale PNG
+static bool writePng(const std::string &path, const uint8_t *frame){
+  std::vector<uint8_t> raw;
+  for(int y = 0; y < DISPLAY_HEIGHT; y++){
+    raw.push_back(0); // filter: none
+    for(int x = 0; x < DISPLAY_WIDTH; x++){
+      uint8_t pair = frame[y * (DISPLAY_WIDTH / 2) + x / 2];
+      raw.push_back(((x & 1) ? pair & 0x0f : pair >> 4) * 17);
+    }
+  }
+  uLongf len = compressBound(raw.size());
+  std::vector<uint8_t> idat(len);
+  if(compress2(idat.data(), &len, raw.data(), raw.size(), Z_BEST_COMPRESSION) != Z_OK){
+    return false;
+  }
+  idat.resize(len);
+
+  static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+  std::vector<uint8_t> png(SIGNATURE, SIGNATURE + 8);
+  putChunk(png, "IHDR", { 0, 0, 0, DISPLAY_WIDTH, 0, 0, 0, DISPLAY_HEIGHT, 8, 0, 0, 0, 0 }); // 8 bit grey, not interlaced
+  putChunk(png, "IDAT", idat);
+  putChunk(png, "IEND", {});
+
+  FILE *f = fopen(path.c_str(), "wb");
+  bool written = f != NULL && fwrite(png.data(), 1, png.size(), f) == png.size();
+  if(f != NULL){
+    written = fclose(f) == 0 && written;
+  }
+  return written;
+}
+
+// 8 bit greyscale PNG of the screen's size, unfiltered into grey; false if it is not one
+static bool readPng(const std::string &path, std::vector<uint8_t> &grey){
+  FILE *f = fopen(path.c_str(), "rb");
+  if(f == NULL){
+    return false;
+  }
+  std::vector<uint8_t> png;
+  uint8_t buf[4096];
+  size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0){
+    png.insert(png.end(), buf, buf + n);
+  }
+  fclose(f);
+
+  std::vector<uint8_t> idat;
+  bool header = false;
+  for(size_t pos = 8; pos + 12 <= png.size(); ){
+    uint32_t len = be32(&png[pos]);
+    if(pos + 12 + len > png.size()){
+      return false;
+    }
+    const uint8_t *type = &png[pos + 4];
+    const uint8_t *data = &png[pos + 8];
+    if(memcmp(type, "IHDR", 4) == 0){
+      header = len == 13 && be32(data) == DISPLAY_WIDTH && be32(data + 4) == DISPLAY_HEIGHT && data[8] == 8 && data[9] == 0 && data[12] == 0;
+    }
+    else if(memcmp(type, "IDAT", 4) == 0){
+      idat.insert(idat.end(), data, data + len);
+    }
+    pos += 12 + len;
+  }
+  const size_t stride = DISPLAY_WIDTH + 1;
+  std::vector<uint8_t> raw(stride * DISPLAY_HEIGHT);
+  uLongf raw_len = raw.size();
+  if(!header || uncompress(raw.data(), &raw_len, idat.data(), idat.size()) != Z_OK || raw_len != raw.size()){
+    return false;
+  }
+
+  grey.assign(DISPLAY_WIDTH * DISPLAY_HEIGHT, 0);
+  for(int y = 0; y < DISPLAY_HEIGHT; y++){
+    const uint8_t *row = &raw[y * stride + 1];
+    uint8_t *out = &grey[y * DISPLAY_WIDTH];
+    const uint8_t *up = y > 0 ? &grey[(y - 1) * DISPLAY_WIDTH] : NULL;
+    for(int x = 0; x < DISPLAY_WIDTH; x++){
+      int a = x > 0 ? out[x - 1] : 0;
+      int b = up != NULL ? up[x] : 0;
+      int c = x > 0 && up != NULL ? up[x - 1] : 0;
+      int pred = 0;
+      switch(raw[y * stride]){
+        case 0: pred = 0; break;
+        case 1: pred = a; break;
+        case 2: pred = b; break;
+        case 3: pred = (a + b) / 2; break;
+        case 4:{ // Paeth
+          int p = a + b - c;
+          int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+          pred = pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+          break;
+        }
+        default: return false;
+      }
+      out[x] = row[x] + pred;
+    }
+  }
+  return true;
+}
+
+// pixels of the 4 bit frame that differ from an 8 bit grey image
+static int differences(const uint8_t *frame, const std::vector<uint8_t> &grey){
+  int count = 0;
+  for(int y = 0; y < DISPLAY_HEIGHT; y++){
+    for(int x = 0; x < DISPLAY_WIDTH; x++){
+      uint8_t pair = frame[y * (DISPLAY_WIDTH / 2) + x / 2];
+      if(((x & 1) ? pair & 0x0f : pair >> 4) * 17 != grey[y * DISPLAY_WIDTH + x]){
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+// With the flush task: wait, in simulated time, for it to finish flush number n since begin(); false if it does not
+static bool waitForFlush(DisplayPanel &panel, uint32_t n, uint32_t timeout_ms){
+  unsigned long started = millis();
+  while(panel.lastFlush().flushes < n){
+    if(millis() - started > timeout_ms){
+      return false;
+    }
+    delay(1);
+  }
+  return true;
+}
+
+/*
+  Flush a screen from a blank panel, as after clearDisplay(). A scrolling screen is then left to take its first step,
+  and stopped once that has been sent, before the next is due; false if it never scrolled. Its stats are the step's.
+*/
+static bool showScreen(DisplayPanel &panel, const sim_screen &screen, display_flush_stats &flush){
+  panel.clearDisplay();
+  panel.display();
+  uint32_t flushes = panel.lastFlush().flushes;
+  if(!screen.scrolls){
+    screen.draw(panel);
+    panel.display();
+    flush = panel.lastFlush();
+    return true;
+  }
+  if(!waitForFlush(panel, flushes + 1, SIM_SCROLL_TIMEOUT_MS)){
+    return false;
+  }
+  screen.draw(panel);
+  panel.display();
+  bool stepped = waitForFlush(panel, flushes + 2, SIM_SCROLL_TIMEOUT_MS)
+    && panel.scrolling() && memcmp(simPanelFrame(), panel.getBuffer(), DISPLAY_WIDTH * DISPLAY_HEIGHT / 2) == 0
+    && waitForFlush(panel, flushes + 3, SIM_SCROLL_TIMEOUT_MS);
+  panel.stopScroll();
+  flush = panel.lastFlush();
+  return stepped;
+}
+
+int main(int argc, char **argv){
+  sim_options opt;
+  if(!parseOptions(argc, argv, opt)){
+    usage(argv[0]);
+    return 2;
+  }
+  if(opt.update_golden){
+    mkdir(opt.golden, 0755);
+  }
+  if(opt.out != NULL){
+    mkdir(opt.out, 0755);
+  }
+
+  DisplayPanel panel(DISPLAY_WIDTH, DISPLAY_HEIGHT, &Wire, -1, DISPLAY_I2C_HZ);
+  if(!panel.begin(SSD1327_I2C_ADDRESS)){
+    fprintf(stderr, "Failed to start the display\n");
+    return 2;
+  }
+  panel.setGlyphs(GLYPH_ATLAS, GLYPH_ATLAS_COUNT);
+  panel.display(); // the whole frame, the first time
+  display_flush_stats full = panel.lastFlush();
+  printf("full frame: %u bytes, %.1fms\n", full.bytes, full.us / 1000.0);
+
+  printf("%-14s %9s %7s %7s %5s %8s  %s\n", "screen", "render_us", "bytes", "windows", "rows", "flush_ms", "golden");
+  int failed = 0;
+  for(const sim_screen &screen : screens()){
+    if(screen.scrolls && !panel.startFlushTask()){
+      fprintf(stderr, "Failed to start the flush task\n");
+      return 2;
+    }
+    auto started = std::chrono::steady_clock::now();
+    for(int i = 0; i < opt.repeat; i++){
+      screen.draw(panel);
+    }
+    double render_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - started).count() / opt.repeat;
+
+    display_flush_stats flush;
+    bool shown_ok = showScreen(panel, screen, flush);
+    const uint8_t *shown = simPanelFrame();
+
+    std::string result;
+    std::string file = screen.name + ".png";
+    if(!shown_ok){
+      result = "FAILED: did not scroll, or the panel differed from the frame buffer first";
+      failed++;
+    }
+    else if(!screen.scrolls && memcmp(shown, panel.getBuffer(), DISPLAY_WIDTH * DISPLAY_HEIGHT / 2) != 0){
+      result = "FAILED: panel differs from the frame buffer";
+      failed++;
+    }
+    else if(opt.update_golden){
+      result = writePng(std::string(opt.golden) + "/" + file, shown) ? "updated" : "FAILED to write";
+      failed += result == "updated" ? 0 : 1;
+    }
+    else{
+      std::vector<uint8_t> grey;
+      if(!readPng(std::string(opt.golden) + "/" + file, grey)){
+        result = "MISSING (run with --update-golden)";
+        failed++;
+      }
+      else{
+        int diff = differences(shown, grey);
+        result = diff == 0 ? "ok" : "DIFFERS in " + std::to_string(diff) + " pixels";
+        failed += diff == 0 ? 0 : 1;
+      }
+    }
+    if(opt.out != NULL && !writePng(std::string(opt.out) + "/" + file, shown)){
+      result += ", FAILED to write to " + std::string(opt.out);
+      failed++;
+    }
+    printf("%-14s %9.1f %7u %7u %5u %8.2f  %s\n", screen.name.c_str(), render_us, flush.bytes, flush.windows, flush.rows,
+      flush.us / 1000.0, result.c_str());
+  }
+
+  fflush(stdout);
+  _exit(failed > 0 ? 1 : 0); // leave the simulated threads (the timer dispatcher) where they are
+}
@@ -0,0 +1,92 @@
+#include <Arduino.h>
+#include <rom/crc.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+#define SIM_PINS 64                 // GPIO numbers with a level and an interrupt handler
+static void (*interrupt_handlers[SIM_PINS])() = { };
+static uint8_t pin_levels[SIM_PINS];
+
+unsigned long millis(){
+  return simMicros() / 1000;
+}
+
+unsigned long micros(){
+  return simMicros();
+}
+
+void delay(uint32_t ms){
+  simSleepMicros((int64_t)ms * 1000);
+}
+
+void yield(){
+  // running code takes no simulated time
+}
+
+void pinMode(uint8_t pin, uint8_t mode){
+}
+
+void digitalWrite(uint8_t pin, uint8_t val){
+  if(pin < SIM_PINS){
+    pin_levels[pin] = val;
+  }
+}
+
+int digitalRead(uint8_t pin){
+  return pin < SIM_PINS ? pin_levels[pin] : LOW;
+}
+
+int digitalPinToInterrupt(int pin){
+  return pin;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode){
+  if(pin < SIM_PINS){
+    interrupt_handlers[pin] = isr; // only rising edges are ever raised
+  }
+}
+
+void detachInterrupt(uint8_t pin){
+  if(pin < SIM_PINS){
+    interrupt_handlers[pin] = NULL;
+  }
+}
+
+void simRaiseInterrupt(uint8_t pin){
+  if(pin < SIM_PINS && interrupt_handlers[pin] != NULL){
+    interrupt_handlers[pin]();
+  }
+}
+
+void *ps_malloc(size_t size){
+  return malloc(size);
+}
+
+bool psramFound(){
+  return true;
+}
+
+uint32_t EspClass::getFreePsram(){
+  return 2 * 1024 * 1024; // Feather ESP32-S2
+}
+
+uint32_t EspClass::getFreeHeap(){
+  return 200 * 1024;
+}
+
+void EspClass::restart(){
+  fprintf(stderr, "ESP.restart() called\n");
+  exit(2);
+}
+
+uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len){
+  crc = ~crc;
+  while(len--){
+    crc ^= *buf++;
+    for(int i = 0; i < 8; i++){
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
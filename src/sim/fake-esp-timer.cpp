@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include "esp_timer.h"
+#include <vector>
+
+#define SIM_PRIORITY_TIMER 22         // ESP-IDF esp_timer task
+
+/*
+  All timers are dispatched from one thread, as the ESP-IDF esp_timer task does.
+*/
+
+struct sim_timer{
+  esp_timer_cb_t callback;
+  void *arg;
+  bool armed = false;
+  int64_t due_us = 0;
+  int64_t period_us = 0;          // 0 for a one-shot timer
+};
+
+static std::vector<sim_timer *> timers;
+static bool dispatcher_started = false;
+
+static sim_timer *nextTimer(){
+  sim_timer *next = NULL;
+  for(sim_timer *t : timers){
+    if(t->armed && (next == NULL || t->due_us < next->due_us)){
+      next = t;
+    }
+  }
+  return next;
+}
+
+static void dispatchTimers(){
+  auto lock = simLock();
+  for(;;){
+    sim_timer *next = nextTimer();
+    int64_t due = next != NULL ? next->due_us : -1;
+    // wake when the earliest timer is due, or as soon as the set of armed timers changes
+    simWait(lock, [next, due](){ sim_timer *t = nextTimer(); return t != next || (t != NULL && t->due_us != due); }, due);
+    next = nextTimer();
+    if(next == NULL || next->due_us > simMicros()){
+      continue;
+    }
+    if(next->period_us > 0){
+      next->due_us += next->period_us;
+    }
+    else{
+      next->armed = false;
+    }
+    esp_timer_cb_t callback = next->callback;
+    void *arg = next->arg;
+    lock.unlock();
+    callback(arg);
+    lock.lock();
+  }
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle){
+  sim_timer *t = new sim_timer();
+  t->callback = create_args->callback;
+  t->arg = create_args->arg;
+  bool start_dispatcher;
+  {
+    auto lock = simLock();
+    timers.push_back(t);
+    start_dispatcher = !dispatcher_started;
+    dispatcher_started = true;
+  }
+  if(start_dispatcher){
+    simSpawn(dispatchTimers, SIM_PRIORITY_TIMER);
+  }
+  *out_handle = t;
+  return ESP_OK;
+}
+
+static esp_err_t startTimer(esp_timer_handle_t timer, uint64_t us, bool periodic){
+  auto lock = simLock();
+  if(timer->armed){
+    return ESP_ERR_INVALID_STATE;
+  }
+  timer->armed = true;
+  timer->due_us = simMicros() + us;
+  timer->period_us = periodic ? us : 0;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us){
+  return startTimer(timer, timeout_us, false);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period){
+  return startTimer(timer, period, true);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer){
+  auto lock = simLock();
+  if(!timer->armed){
+    return ESP_ERR_INVALID_STATE;
+  }
+  timer->armed = false;
+  return ESP_OK;
+}
+
+int64_t esp_timer_get_time(){
+  return simMicros();
+}
@@ -0,0 +1,134 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include <deque>
+#include <vector>
+
+struct sim_task{
+  uint32_t notifications = 0;
+};
+
+struct sim_queue{
+  std::deque<std::vector<uint8_t>> items;
+  UBaseType_t length;
+  UBaseType_t item_size;
+};
+
+struct sim_semaphore{
+  sim_mutex m;
+};
+
+static thread_local sim_task *current_task = NULL;
+
+static int64_t deadline(TickType_t ticks){
+  return ticks == portMAX_DELAY ? -1 : simMicros() + (int64_t)ticks * 1000;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack_depth, void *param, UBaseType_t priority, TaskHandle_t *created){
+  sim_task *task = new sim_task();
+  if(created != NULL){
+    *created = task;
+  }
+  simSpawn([task, code, param](){
+    current_task = task;
+    code(param);
+  }, priority);
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait){
+  sim_task *task = current_task;
+  auto lock = simLock();
+  simWait(lock, [task](){ return task->notifications > 0; }, deadline(ticks_to_wait));
+  uint32_t value = task->notifications;
+  if(value > 0){
+    task->notifications = clear_on_exit ? 0 : value - 1;
+  }
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task){
+  auto lock = simLock();
+  task->notifications++;
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_task_woken){
+  xTaskNotifyGive(task);
+  if(higher_priority_task_woken != NULL){
+    *higher_priority_task_woken = pdTRUE;
+  }
+}
+
+void vTaskDelay(TickType_t ticks){
+  simSleepMicros((int64_t)ticks * 1000);
+}
+
+// Lets any other ready thread run; with priorities not modelled, a microsecond's sleep is the nearest equivalent
+void taskYIELD(){
+  simSleepMicros(1);
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size){
+  sim_queue *queue = new sim_queue();
+  queue->length = length;
+  queue->item_size = item_size;
+  return queue;
+}
+
+static BaseType_t queueSend(QueueHandle_t queue, const void *item, bool to_front){
+  auto lock = simLock();
+  if(queue->items.size() >= queue->length){
+    return pdFAIL; // senders in this project never wait
+  }
+  std::vector<uint8_t> copy((const uint8_t *)item, (const uint8_t *)item + queue->item_size);
+  if(to_front){
+    queue->items.push_front(copy);
+  }
+  else{
+    queue->items.push_back(copy);
+  }
+  return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait){
+  return queueSend(queue, item, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait){
+  return queueSend(queue, item, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks_to_wait){
+  auto lock = simLock();
+  if(!simWait(lock, [queue](){ return !queue->items.empty(); }, deadline(ticks_to_wait))){
+    return pdFAIL;
+  }
+  memcpy(buffer, queue->items.front().data(), queue->item_size);
+  queue->items.pop_front();
+  return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(){
+  return new sim_semaphore();
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(){
+  return new sim_semaphore();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait){
+  return simMutexLock(semaphore->m, deadline(ticks_to_wait)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore){
+  simMutexUnlock(semaphore->m);
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait){
+  return xSemaphoreTake(semaphore, ticks_to_wait);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore){
+  return xSemaphoreGive(semaphore);
+}
@@ -0,0 +1,71 @@
+#include <HTTPClient.h>
+#include <sim-clock.h>
+#include <string>
+
+static std::string root;
+static uint32_t rate = 0;                 // bytes per second
+static uint32_t connect_us = 0;
+
+void simHttpServe(const char *host_dir, uint32_t bytes_per_second, uint32_t connect_ms){
+  root = host_dir;
+  rate = max(bytes_per_second, (uint32_t)1);
+  connect_us = connect_ms * 1000;
+}
+
+bool HTTPClient::begin(const char *url){
+  end();
+  const char *host = strstr(url, "://");
+  if(host == NULL || strncmp(url, "http", 4) != 0){
+    return false;
+  }
+  const char *slash = strchr(host + 3, '/');
+  snprintf(path, sizeof(path), "%s", slash != NULL ? slash : "/");
+  return true;
+}
+
+void HTTPClient::end(){
+  if(client.file != NULL){
+    fclose(client.file);
+  }
+  client = WiFiClient();
+}
+
+int HTTPClient::GET(){
+  if(root.empty() || path[0] == '\0'){
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  simSleepMicros(connect_us);
+  std::string host_path = root + path;
+  client.file = fopen(host_path.c_str(), "rb");
+  if(client.file == NULL){
+    return HTTP_CODE_NOT_FOUND;
+  }
+  fseek(client.file, 0, SEEK_END);
+  client.size = ftell(client.file);
+  fseek(client.file, 0, SEEK_SET);
+  client.pos = 0;
+  client.started_us = simMicros();
+  return HTTP_CODE_OK;
+}
+
+int WiFiClient::available(){
+  if(file == NULL){
+    return 0;
+  }
+  uint64_t arrived = (uint64_t)(simMicros() - started_us) * rate / 1000000;
+  return min(arrived, (uint64_t)size) - pos;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t len){
+  int n = min(len, (size_t)available());
+  if(n <= 0){
+    return -1;
+  }
+  n = fread(buf, 1, n, file);
+  pos += n;
+  return n;
+}
+
+uint8_t WiFiClient::connected(){
+  return file != NULL && pos < size;
+}
@@ -0,0 +1,57 @@
+#include "esp_partition.h"
+#include <string.h>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+static esp_partition_t partition;
+static std::vector<uint8_t> contents;     // erased flash (0xFF) beyond the image
+static bool loaded = false;
+
+bool simFlashLoadImage(const char *host_path, const char *label, int subtype, uint32_t partition_size){
+  std::ifstream in(host_path, std::ios::binary);
+  if(!in){
+    return false;
+  }
+  std::vector<uint8_t> image((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  if(image.size() > partition_size){
+    return false;
+  }
+  contents = image;
+  contents.resize(partition_size, 0xFF);
+  partition.type = ESP_PARTITION_TYPE_DATA;
+  partition.subtype = subtype;
+  partition.address = 0;
+  partition.size = partition_size;
+  snprintf(partition.label, sizeof(partition.label), "%s", label);
+  loaded = true;
+  return true;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label){
+  if(!loaded || type != partition.type || subtype != partition.subtype || (label != NULL && strcmp(label, partition.label) != 0)){
+    return NULL;
+  }
+  return &partition;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *part, size_t src_offset, void *dst, size_t size){
+  if(part != &partition || src_offset > part->size || size > part->size - src_offset){
+    return ESP_FAIL;
+  }
+  memcpy(dst, contents.data() + src_offset, size);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *part, size_t offset, size_t size, esp_partition_mmap_memory_t memory,
+  const void **out_ptr, esp_partition_mmap_handle_t *out_handle){
+  if(part != &partition || offset > part->size || size > part->size - offset){
+    return ESP_FAIL;
+  }
+  *out_ptr = contents.data() + offset;
+  *out_handle = 1;
+  return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle){
+}
@@ -0,0 +1,321 @@
+#include <SD.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+/*
+  Latency profile: one setting or sample per line, '#' starts a comment.
+    throughput <KB/s>   sustained transfer rate once a read is under way
+    open <us>           time to open a file (directory walk on the FAT)
+    <us>                fixed cost of one read command; all samples are replayed in turn, cyclically
+*/
+struct sd_profile{
+  double bytes_per_us = 1.5;                // 1.5MB/s; what a class 10 card sustains in SPI mode
+  int64_t open_us = 2000;
+  std::vector<int64_t> read_us = {300};
+  size_t next_sample = 0;
+};
+
+struct sim_file{
+  std::string path;
+  std::string name;
+  bool directory = false;
+  std::shared_ptr<std::vector<uint8_t>> data;
+  size_t pos = 0;
+  bool writable = false;
+  bool open = true;
+  time_t mtime = 0;
+  std::vector<std::string> children;      // directories only; full paths, sorted
+  size_t next_child = 0;
+};
+
+SDFS SD;
+
+static std::string root = ".";
+static std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> written;   // files written during the run; never reach the host
+static sd_profile profile;
+static double clock_bytes_per_us = 0.5;     // ceiling set by the SPI clock; SD.begin()'s default 4MHz
+
+static sim_mutex bus;
+static std::atomic<uint32_t> bus_conflicts(0);
+
+void simSdSetRoot(const char *host_dir){
+  root = host_dir;
+  while(root.size() > 1 && root.back() == '/'){
+    root.pop_back();
+  }
+}
+
+bool simSdLoadProfile(const char *profile_path){
+  std::ifstream in(profile_path);
+  if(!in){
+    return false;
+  }
+  sd_profile loaded;
+  loaded.read_us.clear();
+  std::string line;
+  while(std::getline(in, line)){
+    line = line.substr(0, line.find('#'));
+    char key[32];
+    double value;
+    if(sscanf(line.c_str(), " throughput %lf", &value) == 1){
+      loaded.bytes_per_us = value * 1024 / 1000000;
+    }
+    else if(sscanf(line.c_str(), " open %lf", &value) == 1){
+      loaded.open_us = value;
+    }
+    else if(sscanf(line.c_str(), " %lf", &value) == 1){
+      loaded.read_us.push_back(value);
+    }
+    else if(sscanf(line.c_str(), " %31s", key) == 1){
+      fprintf(stderr, "%s: unrecognised line: %s\n", profile_path, line.c_str());
+      return false;
+    }
+  }
+  if(loaded.read_us.empty() || loaded.bytes_per_us <= 0){
+    return false;
+  }
+  profile = loaded;
+  return true;
+}
+
+void simBusEnter(){
+  if(simMutexHeldByOther(bus)){
+    bus_conflicts++; // the SPI driver serialises transactions, so the second device waits
+  }
+  simMutexLock(bus);
+}
+
+void simBusExit(){
+  simMutexUnlock(bus);
+}
+
+uint32_t simBusConflicts(){
+  return bus_conflicts;
+}
+
+void simBusHold(int64_t us){
+  simBusEnter();
+  simSleepMicros(us);
+  simBusExit();
+}
+
+static int64_t readLatency(size_t len){
+  int64_t us = profile.read_us[profile.next_sample];
+  profile.next_sample = (profile.next_sample + 1) % profile.read_us.size();
+  return us + (int64_t)(len / min(profile.bytes_per_us, clock_bytes_per_us));
+}
+
+static int64_t openLatency(){
+  return profile.open_us;
+}
+
+static std::string hostPath(const std::string &path){
+  return root + path;
+}
+
+static std::string baseName(const std::string &path){
+  size_t slash = path.rfind('/');
+  return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static std::string normalise(const char *path){
+  std::string p = path[0] == '/' ? path : std::string("/") + path;
+  while(p.size() > 1 && p.back() == '/'){
+    p.pop_back();
+  }
+  return p;
+}
+
+bool SDFS::begin(uint8_t cs, SPIClass &spi, uint32_t frequency){
+  clock_bytes_per_us = frequency / 8 / 1e6;
+  struct stat st;
+  return stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+File SDFS::open(const char *path, const char *mode){
+  simBusHold(openLatency());
+  std::string p = normalise(path);
+  auto f = std::make_shared<sim_file>();
+  f->path = p;
+  f->name = baseName(p);
+  f->mtime = time(NULL);
+
+  if(strcmp(mode, FILE_READ) != 0){
+    auto existing = written.find(p);
+    if(strcmp(mode, FILE_WRITE) == 0 || existing == written.end()){
+      written[p] = std::make_shared<std::vector<uint8_t>>();
+    }
+    f->data = written[p];
+    f->pos = strcmp(mode, FILE_APPEND) == 0 ? f->data->size() : 0;
+    f->writable = true;
+    return File(f);
+  }
+
+  auto overlay = written.find(p);
+  if(overlay != written.end()){
+    f->data = overlay->second;
+    return File(f);
+  }
+
+  struct stat st;
+  std::string host = hostPath(p);
+  if(stat(host.c_str(), &st) != 0){
+    return File();
+  }
+  f->mtime = st.st_mtime;
+  if(S_ISDIR(st.st_mode)){
+    f->directory = true;
+    std::set<std::string> names;
+    DIR *d = opendir(host.c_str());
+    for(struct dirent *e = d != NULL ? readdir(d) : NULL; e != NULL; e = readdir(d)){
+      if(strcmp(e->d_name, ".") != 0 && strcmp(e->d_name, "..") != 0){
+        names.insert(e->d_name);
+      }
+    }
+    if(d != NULL){
+      closedir(d);
+    }
+    std::string prefix = p == "/" ? "/" : p + "/";
+    for(auto &w : written){
+      if(w.first.compare(0, prefix.size(), prefix) == 0 && w.first.find('/', prefix.size()) == std::string::npos){
+        names.insert(w.first.substr(prefix.size()));
+      }
+    }
+    for(auto &n : names){
+      f->children.push_back(prefix + n);
+    }
+    return File(f);
+  }
+
+  std::ifstream in(host, std::ios::binary);
+  f->data = std::make_shared<std::vector<uint8_t>>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return File(f);
+}
+
+bool SDFS::exists(const char *path){
+  std::string p = normalise(path);
+  struct stat st;
+  return written.count(p) > 0 || stat(hostPath(p).c_str(), &st) == 0;
+}
+
+bool SDFS::remove(const char *path){
+  return written.erase(normalise(path)) > 0; // host files are never removed
+}
+
+bool SDFS::rename(const char *from, const char *to){
+  auto f = written.find(normalise(from));
+  if(f == written.end()){
+    return false; // host files are never renamed
+  }
+  auto data = f->second;
+  written.erase(f);
+  written[normalise(to)] = data;
+  return true;
+}
+
+bool SDFS::mkdir(const char *path){
+  return true; // directories of written files exist implicitly
+}
+
+File::operator bool() const{
+  return f != nullptr && f->open;
+}
+
+size_t File::read(uint8_t *buf, size_t size){
+  if(!*this || f->directory){
+    return 0;
+  }
+  size_t n = min(size, f->data->size() - min(f->pos, f->data->size()));
+  simBusHold(readLatency(n));
+  memcpy(buf, f->data->data() + f->pos, n);
+  f->pos += n;
+  return n;
+}
+
+int File::read(){
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::write(const uint8_t *buf, size_t size){
+  if(!*this || !f->writable){
+    return 0;
+  }
+  simBusHold(readLatency(size));
+  if(f->data->size() < f->pos + size){
+    f->data->resize(f->pos + size);
+  }
+  memcpy(f->data->data() + f->pos, buf, size);
+  f->pos += size;
+  return size;
+}
+
+size_t File::write(uint8_t c){
+  return write(&c, 1);
+}
+
+int File::available(){
+  return *this && !f->directory ? f->data->size() - min(f->pos, f->data->size()) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode){
+  if(!*this || f->directory){
+    return false;
+  }
+  size_t base = mode == SeekSet ? 0 : (mode == SeekCur ? f->pos : f->data->size());
+  if(base + pos > f->data->size()){
+    return false;
+  }
+  f->pos = base + pos;
+  return true;
+}
+
+size_t File::position() const{
+  return f != nullptr ? f->pos : 0;
+}
+
+size_t File::size() const{
+  return f != nullptr && f->data != nullptr ? f->data->size() : 0;
+}
+
+void File::close(){
+  if(f != nullptr){
+    f->open = false;
+  }
+  f = nullptr;
+}
+
+const char *File::name() const{
+  return f != nullptr ? f->name.c_str() : "";
+}
+
+const char *File::path() const{
+  return f != nullptr ? f->path.c_str() : "";
+}
+
+bool File::isDirectory(){
+  return *this && f->directory;
+}
+
+File File::openNextFile(const char *mode){
+  if(!isDirectory() || f->next_child >= f->children.size()){
+    return File();
+  }
+  return SD.open(f->children[f->next_child++].c_str(), mode);
+}
+
+void File::rewindDirectory(){
+  if(isDirectory()){
+    f->next_child = 0;
+  }
+}
+
+time_t File::getLastWrite(){
+  return f != nullptr ? f->mtime : 0;
+}
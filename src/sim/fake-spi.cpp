@@ -0,0 +1,19 @@
+#include <SPI.h>
+#include <Adafruit_VS1053.h>
+
+SPIClass SPI;
+
+void SPIClass::beginTransaction(SPISettings settings){
+  simBusEnter();
+  clock = settings.clock;
+  simSleepMicros(SIM_SPI_TRANSACTION_US);
+}
+
+void SPIClass::endTransaction(){
+  simBusExit();
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size){
+  simSleepMicros((int64_t)size * 8 * 1000000 / clock);
+  simCodecData(data, size);
+}
@@ -0,0 +1,192 @@
+#include <Adafruit_SSD1327.h>
+
+#define SIM_PANEL_WIDTH 128
+#define SIM_PANEL_HEIGHT 128
+#define SIM_I2C_CONTROL_COMMAND 0x00  // control byte ahead of command bytes; 0x40 ahead of data
+
+TwoWire Wire;
+
+static uint8_t gddram[SIM_PANEL_HEIGHT * SIM_PANEL_WIDTH / 2];
+static uint8_t first_row = 0, last_row = SIM_PANEL_HEIGHT - 1;
+static uint8_t first_col = 0, last_col = SIM_PANEL_WIDTH / 2 - 1;   // bytes (two pixels)
+static uint8_t row = 0, col = 0;
+static uint64_t i2c_bytes = 0;
+
+// Row and column addresses; other commands do not change what the panel holds
+static void command(const uint8_t *c, size_t n){
+  for(size_t i = 0; i < n; i++){
+    if((c[i] == SSD1327_SETROW || c[i] == SSD1327_SETCOLUMN) && i + 2 < n){
+      uint8_t first = c[i + 1];
+      uint8_t last = c[i + 2];
+      if(c[i] == SSD1327_SETROW){
+        row = first_row = min(first, (uint8_t)(SIM_PANEL_HEIGHT - 1));
+        last_row = min(last, (uint8_t)(SIM_PANEL_HEIGHT - 1));
+      }
+      else{
+        col = first_col = min(first, (uint8_t)(SIM_PANEL_WIDTH / 2 - 1));
+        last_col = min(last, (uint8_t)(SIM_PANEL_WIDTH / 2 - 1));
+      }
+      i += 2;
+    }
+  }
+}
+
+// Into the address window, a row at a time, wrapping round to its start as the chip does
+static void data(const uint8_t *d, size_t n){
+  for(size_t i = 0; i < n; i++){
+    gddram[row * (SIM_PANEL_WIDTH / 2) + col] = d[i];
+    if(col++ >= last_col){
+      col = first_col;
+      row = row >= last_row ? first_row : row + 1;
+    }
+  }
+}
+
+bool Adafruit_I2CDevice::write(const uint8_t *buffer, size_t len, bool stop, const uint8_t *prefix_buffer, size_t prefix_len){
+  size_t bytes = 1 + prefix_len + len; // address byte first
+  i2c_bytes += bytes;
+  simSleepMicros((int64_t)bytes * 9 * 1000000 / clock);
+  if(prefix_len > 0 && prefix_buffer[0] == SIM_I2C_CONTROL_COMMAND){
+    command(buffer, len);
+  }
+  else{
+    data(buffer, len);
+  }
+  return true;
+}
+
+bool Adafruit_I2CDevice::setSpeed(uint32_t desiredclk){
+  clock = desiredclk;
+  return true;
+}
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h){
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+  for(int16_t i = 0; i < w; i++){
+    drawPixel(x + i, y, color);
+  }
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  for(int16_t j = 0; j < h; j++){
+    drawFastHLine(x, y + j, w, color);
+  }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color){
+  int16_t row_bytes = (w + 7) / 8;
+  for(int16_t j = 0; j < h; j++){
+    for(int16_t i = 0; i < w; i++){
+      if(bitmap[j * row_bytes + i / 8] & (0x80 >> (i & 7))){
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size){
+  if(bg != color){
+    fillRect(x, y, 6 * size, 8 * size, bg);
+  }
+  fillRect(x, y, 5 * size, size, color);
+  fillRect(x, y + 6 * size, 5 * size, size, color);
+  fillRect(x, y, size, 7 * size, color);
+  fillRect(x + 4 * size, y, size, 7 * size, color);
+}
+
+void Adafruit_GFX::setRotation(uint8_t r){
+  rotation = r & 3;
+  _width = rotation & 1 ? HEIGHT : WIDTH;
+  _height = rotation & 1 ? WIDTH : HEIGHT;
+}
+
+Adafruit_GrayOLED::Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h, TwoWire *twi, int8_t rst_pin, uint32_t preclk, uint32_t postclk)
+  : Adafruit_GFX(w, h), i2c_preclk(preclk), i2c_postclk(postclk){
+}
+
+Adafruit_GrayOLED::~Adafruit_GrayOLED(){
+  free(buffer);
+  delete i2c_dev;
+}
+
+bool Adafruit_GrayOLED::_init(uint8_t i2caddr){
+  if(buffer == NULL){
+    buffer = (uint8_t *)malloc((size_t)WIDTH * HEIGHT / 2);
+    i2c_dev = new Adafruit_I2CDevice();
+  }
+  clearDisplay();
+  return buffer != NULL;
+}
+
+void Adafruit_GrayOLED::drawPixel(int16_t x, int16_t y, uint16_t color){
+  if(x < 0 || x >= width() || y < 0 || y >= height()){
+    return;
+  }
+  switch(rotation){
+    case 1: std::swap(x, y); x = WIDTH - x - 1; break;
+    case 2: x = WIDTH - x - 1; y = HEIGHT - y - 1; break;
+    case 3: std::swap(x, y); y = HEIGHT - y - 1; break;
+  }
+  window_x1 = min(window_x1, x);
+  window_y1 = min(window_y1, y);
+  window_x2 = max(window_x2, x);
+  window_y2 = max(window_y2, y);
+  uint8_t &pair = buffer[y * (WIDTH / 2) + x / 2];
+  pair = (x & 1) ? (pair & 0xf0) | (color & 0x0f) : (pair & 0x0f) | (color & 0x0f) << 4;
+}
+
+void Adafruit_GrayOLED::clearDisplay(){
+  memset(buffer, 0, (size_t)WIDTH * HEIGHT / 2);
+  window_x1 = 0;
+  window_y1 = 0;
+  window_x2 = WIDTH - 1;
+  window_y2 = HEIGHT - 1;
+}
+
+bool Adafruit_GrayOLED::oled_commandList(const uint8_t *c, uint8_t n){
+  uint8_t dc_byte = SIM_I2C_CONTROL_COMMAND;
+  return i2c_dev->write(c, n, true, &dc_byte, 1);
+}
+
+Adafruit_SSD1327::Adafruit_SSD1327(uint16_t w, uint16_t h, TwoWire *twi, int8_t rst_pin, uint32_t preclk, uint32_t postclk)
+  : Adafruit_GrayOLED(4, w, h, twi, rst_pin, preclk, postclk){
+}
+
+bool Adafruit_SSD1327::begin(uint8_t i2caddr, bool reset){
+  return _init(i2caddr);
+}
+
+void Adafruit_SSD1327::display(){
+  if(window_x1 > window_x2 || window_y1 > window_y2){
+    return;
+  }
+  uint8_t cmd[] = { SSD1327_SETROW, (uint8_t)window_y1, (uint8_t)window_y2,
+                    SSD1327_SETCOLUMN, (uint8_t)(window_x1 / 2), (uint8_t)(window_x2 / 2) };
+  uint8_t dc_byte = 0x40;
+  i2c_dev->setSpeed(i2c_preclk);
+  oled_commandList(cmd, sizeof(cmd));
+  for(int16_t y = window_y1; y <= window_y2; y++){
+    const uint8_t *p = buffer + y * (WIDTH / 2) + window_x1 / 2;
+    for(int16_t left = window_x2 / 2 - window_x1 / 2 + 1; left > 0; ){
+      size_t len = min((size_t)left, i2c_dev->maxBufferSize() - 1);
+      i2c_dev->write(p, len, true, &dc_byte, 1);
+      p += len;
+      left -= len;
+    }
+  }
+  i2c_dev->setSpeed(i2c_postclk);
+  window_x1 = 1024;
+  window_y1 = 1024;
+  window_x2 = -1;
+  window_y2 = -1;
+}
+
+const uint8_t *simPanelFrame(){
+  return gddram;
+}
+
+uint64_t simPanelI2cBytes(){
+  return i2c_bytes;
+}
@@ -0,0 +1,255 @@
+#include <Adafruit_VS1053.h>
+#include <SPI.h>
+#include "audio-player.h"
+
+#define SIM_CODEC_TICK_US 1000    // consumer granularity; 1ms is about 176 bytes of CD quality WAV
+#define SIM_CODEC_SDI_US_PER_BYTE 1   // playData(), at the Adafruit library's 8MHz; each call is a transaction of its own
+#define SIM_CODEC_SCI_US 10       // one register access
+#define SIM_PRIORITY_CODEC 25     // the chip runs independently of every task
+#define SIM_WAV_HEADER_MAX 4096   // a RIFF header whose data chunk is not within this is given up on
+
+static size_t fifo_level = 0;
+static double bytes_per_us = 0;
+static double drained = 0;              // fraction of a byte carried to the next tick
+static bool cancelled = false;          // FIFO emptied on purpose; not an underrun until data arrives again
+static int64_t starved_since = -1;
+static int64_t last_write_us = -1;
+static sim_codec_stats stats;
+static uint16_t registers[16];
+static uint16_t wram_addr = 0;
+static int8_t dreq_pin = -1;
+static int8_t dcs_pin = -1;
+static bool consumer_started = false;
+
+enum wav_state { WAV_SEEK, WAV_HEADER, WAV_DATA };
+static wav_state wav = WAV_SEEK;
+static uint8_t wav_header[SIM_WAV_HEADER_MAX];
+static size_t wav_header_len = 0;       // WAV_SEEK: bytes of "RIFF" matched; WAV_HEADER: bytes of the header so far
+static uint64_t wav_data_left = 0;      // 0xFFFFFFFF is never used up
+
+static bool dreqHigh(){
+  return VS1053_FIFO_SIZE - fifo_level >= VS1053_DATABUFFERLEN;
+}
+
+static void consume(){
+  int64_t last = simMicros();
+  for(;;){
+    simSleepMicros(SIM_CODEC_TICK_US);
+    int64_t now = simMicros();
+    bool was_high = dreqHigh();
+    drained += bytes_per_us * (now - last);
+    last = now;
+    size_t n = min((size_t)drained, fifo_level);
+    drained -= (size_t)drained;
+    fifo_level -= n;
+
+    bool playing = audioIsPlaying() && stats.first_byte_us >= 0 && !cancelled;
+    if(fifo_level == 0 && playing){
+      if(starved_since < 0){
+        starved_since = now;
+        stats.underruns++;
+      }
+    }
+    else if(starved_since >= 0){
+      stats.starved_us += now - starved_since;
+      starved_since = -1;
+    }
+    bool edge = !was_high && dreqHigh();
+    if(edge && dreq_pin >= 0){
+      simRaiseInterrupt(dreq_pin);
+    }
+  }
+}
+
+static uint32_t le32(const uint8_t *p){
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void decode(const uint8_t *data, size_t len);
+
+static void wavReset(){
+  wav = WAV_SEEK;
+  wav_header_len = 0;
+  stats.wav_open = false;
+}
+
+// The header so far; true once its data chunk has been found (or it has been given up on) and the state moved on
+static bool wavHeaderDone(){
+  size_t pos = 12;
+  while(pos + 8 <= wav_header_len){
+    uint32_t chunk_len = le32(wav_header + pos + 4);
+    if(memcmp(wav_header + pos, "data", 4) == 0){
+      stats.wav_files++;
+      wav_data_left = chunk_len == 0xFFFFFFFF ? UINT64_MAX : chunk_len;
+      wav = WAV_DATA;
+      stats.wav_open = true;
+      // anything after the chunk header is data
+      size_t extra = wav_header_len - pos - 8;
+      wav_header_len = 0;
+      decode(wav_header + pos + 8, extra);
+      return true;
+    }
+    pos += 8 + (uint64_t)chunk_len + (chunk_len & 1);
+  }
+  if(wav_header_len == SIM_WAV_HEADER_MAX || (wav_header_len >= 12 && memcmp(wav_header + 8, "WAVE", 4) != 0)){
+    wavReset();
+    return true;
+  }
+  return false;
+}
+
+static void decode(const uint8_t *data, size_t len){
+  while(len > 0){
+    if(wav == WAV_DATA){
+      size_t n = min((uint64_t)len, wav_data_left);
+      stats.wav_samples += n;
+      if(wav_data_left != UINT64_MAX){
+        wav_data_left -= n;
+      }
+      data += n;
+      len -= n;
+      if(wav_data_left == 0){
+        wavReset();
+      }
+    }
+    else if(wav == WAV_HEADER){
+      wav_header[wav_header_len++] = *data++;
+      len--;
+      wavHeaderDone();
+    }
+    else{
+      static const char RIFF[] = "RIFF";
+      uint8_t c = *data++;
+      len--;
+      wav_header_len = c == RIFF[wav_header_len] ? wav_header_len + 1 : c == 'R' ? 1 : 0;
+      if(wav_header_len == 4){
+        memcpy(wav_header, RIFF, 4);
+        wav = WAV_HEADER;
+      }
+    }
+  }
+}
+
+void simCodecReset(uint32_t bytes_per_second){
+  bytes_per_us = bytes_per_second / 1e6;
+  fifo_level = 0;
+  drained = 0;
+  cancelled = false;
+  starved_since = -1;
+  last_write_us = -1;
+  stats = sim_codec_stats();
+  stats.started_us = simMicros();
+  wavReset();
+}
+
+sim_codec_stats simCodecStats(){
+  sim_codec_stats s = stats;
+  if(starved_since >= 0){
+    s.starved_us += simMicros() - starved_since;
+  }
+  return s;
+}
+
+size_t simCodecFifoLevel(){
+  return fifo_level;
+}
+
+// A write of len bytes to the data port
+static void receive(const uint8_t *data, size_t len){
+  int64_t now = simMicros();
+  if(stats.first_byte_us < 0){
+    stats.first_byte_us = now;
+  }
+  else if(audioIsPlaying() && !cancelled){
+    stats.worst_feed_gap_us = max(stats.worst_feed_gap_us, now - last_write_us);
+  }
+  last_write_us = now;
+  cancelled = false;
+
+  size_t n = min(len, VS1053_FIFO_SIZE - fifo_level);
+  if(n < len){
+    stats.overflows++;
+  }
+  fifo_level += n;
+  stats.bytes += len;
+  decode(data, n);
+}
+
+void simCodecData(const uint8_t *data, size_t len){
+  if(dcs_pin >= 0 && digitalRead(dcs_pin) == LOW){
+    receive(data, len);
+  }
+}
+
+Adafruit_VS1053::Adafruit_VS1053(int8_t rst, int8_t cs, int8_t dcs, int8_t dreq) : _dreq(dreq), _dcs(dcs){}
+
+uint8_t Adafruit_VS1053::begin(){
+  reset();
+  dreq_pin = _dreq;
+  dcs_pin = _dcs;
+  pinMode(_dcs, OUTPUT);
+  digitalWrite(_dcs, HIGH);
+  if(!consumer_started){
+    consumer_started = true;
+    simSpawn(consume, SIM_PRIORITY_CODEC);
+  }
+  return 4; // VS1053 version number, as read from SCI_STATUS
+}
+
+void Adafruit_VS1053::reset(){
+  softReset();
+  setVolume(40, 40); // as the Adafruit library does
+}
+
+void Adafruit_VS1053::softReset(){
+  registers[VS1053_REG_MODE] = VS1053_MODE_SM_SDINEW;
+  fifo_level = 0;
+  cancelled = true;
+  wavReset();
+}
+
+uint16_t Adafruit_VS1053::sciRead(uint8_t addr){
+  simBusHold(SIM_CODEC_SCI_US);
+  if(addr == VS1053_REG_WRAM){
+    return 0; // end fill byte (0x1e06) and anything else in WRAM
+  }
+  return registers[addr & 0x0F];
+}
+
+void Adafruit_VS1053::sciWrite(uint8_t addr, uint16_t data){
+  simBusHold(SIM_CODEC_SCI_US);
+  if(addr == VS1053_REG_WRAMADDR){
+    wram_addr = data;
+  }
+  if(addr == VS1053_REG_MODE && (data & (VS1053_MODE_SM_CANCEL | VS1053_MODE_SM_RESET))){
+    fifo_level = 0; // decoding abandoned; whatever was buffered is never played
+    cancelled = true;
+    wavReset();
+    data &= ~(VS1053_MODE_SM_CANCEL | VS1053_MODE_SM_RESET);
+  }
+  registers[addr & 0x0F] = data;
+}
+
+void Adafruit_VS1053::setVolume(uint8_t left, uint8_t right){
+  sciWrite(VS1053_REG_VOLUME, (left << 8) | right);
+}
+
+void Adafruit_VS1053::playData(uint8_t *buffer, uint8_t buffsiz){
+  simBusHold(SIM_SPI_TRANSACTION_US + buffsiz * SIM_CODEC_SDI_US_PER_BYTE);
+  receive(buffer, buffsiz);
+}
+
+boolean Adafruit_VS1053::readyForData(){
+  return dreqHigh();
+}
+
+void Adafruit_VS1053::applyPatch(const uint16_t *patch, uint16_t patchsize){
+  simBusHold(patchsize * SIM_CODEC_SCI_US);
+}
+
+Adafruit_VS1053_FilePlayer::Adafruit_VS1053_FilePlayer(int8_t rst, int8_t cs, int8_t dcs, int8_t dreq, int8_t cardCS)
+  : Adafruit_VS1053(rst, cs, dcs, dreq){}
+
+boolean Adafruit_VS1053_FilePlayer::begin(){
+  return Adafruit_VS1053::begin() == 4;
+}
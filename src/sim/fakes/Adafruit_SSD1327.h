@@ -0,0 +1,81 @@
+#ifndef SIM_ADAFRUIT_SSD1327_H
+#define SIM_ADAFRUIT_SSD1327_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+/*
+  Simulated SSD1327 (128x128, 4 bits per pixel) on I2C, with the parts of Adafruit_GFX and Adafruit_GrayOLED that
+  DisplayPanel uses. Drawing goes into the frame buffer as in the Adafruit libraries; what is sent over I2C lands in a
+  simulated GDDRAM, addressed by the row and column commands as on the chip, so what the panel would show (simPanelFrame())
+  can be told apart from what was drawn. Each transfer takes nine clock periods a byte (eight bits and the ACK),
+  including the address byte and the control byte ahead of the data, at the speed set by setSpeed(), in simulated time.
+
+  Adafruit's built in font is not available on the host: drawChar() draws a box in the character's cell. Text drawn
+  from a glyph atlas (DisplayPanel::drawText()) does not go through it.
+*/
+
+#define SSD1327_I2C_ADDRESS 0x3D
+#define SSD1327_BLACK 0x0
+#define SSD1327_WHITE 0xF
+#define SSD1327_SETCOLUMN 0x15
+#define SSD1327_SETROW 0x75
+
+#define SIM_I2C_MAX_BUFFER 128    // bytes a transfer, as the ESP32 core's Wire buffer
+
+class Adafruit_I2CDevice{
+  public:
+    bool write(const uint8_t *buffer, size_t len, bool stop = true, const uint8_t *prefix_buffer = NULL, size_t prefix_len = 0);
+    size_t maxBufferSize(){ return SIM_I2C_MAX_BUFFER; }
+    bool setSpeed(uint32_t desiredclk);
+  private:
+    uint32_t clock = 100000;
+};
+
+class Adafruit_GFX{
+  public:
+    Adafruit_GFX(int16_t w, int16_t h);
+    virtual ~Adafruit_GFX(){}
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+    void setRotation(uint8_t r);
+    uint8_t getRotation() const{ return rotation; }
+    int16_t width() const{ return _width; }
+    int16_t height() const{ return _height; }
+  protected:
+    const int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+    uint8_t rotation = 0;
+};
+
+class Adafruit_GrayOLED : public Adafruit_GFX{
+  public:
+    Adafruit_GrayOLED(uint8_t bpp, uint16_t w, uint16_t h, TwoWire *twi, int8_t rst_pin, uint32_t preclk, uint32_t postclk);
+    ~Adafruit_GrayOLED();
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void clearDisplay();
+    uint8_t *getBuffer(){ return buffer; }
+  protected:
+    bool _init(uint8_t i2caddr);
+    bool oled_commandList(const uint8_t *c, uint8_t n);
+    uint8_t *buffer = NULL;
+    int16_t window_x1, window_y1, window_x2, window_y2;
+    Adafruit_I2CDevice *i2c_dev = NULL;
+    uint32_t i2c_preclk, i2c_postclk;
+};
+
+class Adafruit_SSD1327 : public Adafruit_GrayOLED{
+  public:
+    Adafruit_SSD1327(uint16_t w, uint16_t h, TwoWire *twi = &Wire, int8_t rst_pin = -1, uint32_t preclk = 400000, uint32_t postclk = 100000);
+    bool begin(uint8_t i2caddr = SSD1327_I2C_ADDRESS, bool reset = true);
+    void display();               // the dirty window
+};
+
+// Provided in simulator
+const uint8_t *simPanelFrame();   // GDDRAM: what the panel shows, in the frame buffer's layout
+uint64_t simPanelI2cBytes();      // sent to the panel since start, framing included
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef SIM_ADAFRUIT_VS1053_H
+#define SIM_ADAFRUIT_VS1053_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+/*
+  Simulated VS1053. Data written to it enters a 2048 byte FIFO, as on the chip, which a consumer thread drains at the bit
+  rate of the audio being played (simCodecReset()). DREQ is high while at least 32 bytes are free and its rising edge
+  calls the handler attached to the DREQ pin, as the real pin would. Data arrives through playData(), or through SPI
+  writes while the data port's chip select (dcs) is low.
+
+  The FIFO running dry while the player reports it is playing is an underrun.
+
+  Of the data itself only WAV files are followed, as the decoder would: a RIFF header starts a file and its data chunk
+  length says where the file ends (0xFFFFFFFF never does). Anything else outside a file is skipped. A header sent
+  while the previous file's data chunk has not ended is played as samples instead, so it is not counted as a file.
+*/
+
+#define VS1053_DATABUFFERLEN 32
+#define VS1053_FIFO_SIZE 2048
+
+#define VS1053_REG_MODE 0x00
+#define VS1053_REG_STATUS 0x01
+#define VS1053_REG_BASS 0x02
+#define VS1053_REG_CLOCKF 0x03
+#define VS1053_REG_DECODETIME 0x04
+#define VS1053_REG_AUDATA 0x05
+#define VS1053_REG_WRAM 0x06
+#define VS1053_REG_WRAMADDR 0x07
+#define VS1053_REG_HDAT0 0x08
+#define VS1053_REG_HDAT1 0x09
+#define VS1053_REG_VOLUME 0x0B
+
+#define VS1053_MODE_SM_DIFF 0x0001
+#define VS1053_MODE_SM_LAYER12 0x0002
+#define VS1053_MODE_SM_RESET 0x0004
+#define VS1053_MODE_SM_CANCEL 0x0008
+#define VS1053_MODE_SM_EARSPKLO 0x0010
+#define VS1053_MODE_SM_TESTS 0x0020
+#define VS1053_MODE_SM_STREAM 0x0040
+#define VS1053_MODE_SM_SDINEW 0x0800
+#define VS1053_MODE_SM_ADPCM 0x1000
+#define VS1053_MODE_SM_LINE1 0x4000
+#define VS1053_MODE_SM_CLKRANGE 0x8000
+
+#define VS1053_FILEPLAYER_PIN_INT 5
+
+class Adafruit_VS1053{
+  public:
+    Adafruit_VS1053(int8_t rst, int8_t cs, int8_t dcs, int8_t dreq);
+    uint8_t begin();
+    void reset();
+    void softReset();
+    uint16_t sciRead(uint8_t addr);
+    void sciWrite(uint8_t addr, uint16_t data);
+    void setVolume(uint8_t left, uint8_t right);
+    void playData(uint8_t *buffer, uint8_t buffsiz);
+    boolean readyForData();
+    void applyPatch(const uint16_t *patch, uint16_t patchsize);
+  protected:
+    uint8_t _dreq;
+    int8_t _dcs;
+};
+
+class Adafruit_VS1053_FilePlayer : public Adafruit_VS1053{
+  public:
+    Adafruit_VS1053_FilePlayer(int8_t rst, int8_t cs, int8_t dcs, int8_t dreq, int8_t cardCS);
+    boolean begin();
+};
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct sim_codec_stats{
+  int64_t started_us = 0;         // simCodecReset()
+  int64_t first_byte_us = -1;     // first byte written; -1 if none yet
+  uint64_t bytes = 0;
+  uint32_t underruns = 0;         // times the FIFO ran dry while playing
+  int64_t starved_us = 0;         // total time spent dry while playing
+  int64_t worst_feed_gap_us = 0;  // longest interval between writes while playing
+  uint32_t overflows = 0;         // writes while DREQ was low that did not fit
+  uint32_t wav_files = 0;         // WAV headers recognised, up to and including their data chunk
+  uint64_t wav_samples = 0;       // bytes decoded as WAV sample data
+  bool wav_open = false;          // the last WAV file's data chunk has not ended
+};
+
+// Provided in simulator
+void simCodecReset(uint32_t bytes_per_second);      // start a measurement, consuming at this rate
+sim_codec_stats simCodecStats();
+size_t simCodecFifoLevel();
+void simCodecData(const uint8_t *data, size_t len);  // from the SPI bus; ignored unless the data port is selected
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+/*
+  The parts of the ESP32 Arduino core used by the audio libraries, on the host.
+  min()/max() come from std:: as in the ESP32 core, so mismatched argument types fail here as they would on the board.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include "sim-clock.h"
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define IRAM_ATTR
+#define PROGMEM
+#define F(x) (x)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+void simRaiseInterrupt(uint8_t pin);      // simulator only; call the handler attached to pin
+
+void *ps_malloc(size_t size);
+bool psramFound();
+
+class EspClass{
+  public:
+    uint32_t getFreePsram();
+    uint32_t getFreeHeap();
+    void restart();
+};
+extern EspClass ESP;
+
+class HardwareSerial{
+  public:
+    void begin(unsigned long baud){}
+    template<typename T> void print(T value){ printValue(value); }
+    template<typename T> void println(T value){ printValue(value); fputc('\n', stdout); }
+    void println(){ fputc('\n', stdout); }
+  private:
+    void printValue(const char *value){ fputs(value, stdout); }
+    void printValue(char *value){ fputs(value, stdout); }
+    template<typename T> void printValue(T value){ printf("%lld", (long long)value); }
+};
+extern HardwareSerial Serial;
+
+#endif
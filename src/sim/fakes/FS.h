@@ -0,0 +1,45 @@
+#ifndef SIM_FS_H
+#define SIM_FS_H
+
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct sim_file;
+
+/*
+  File on the simulated SD card (see SD.h). Same interface as fs::File in the ESP32 core.
+*/
+class File{
+  public:
+    File(){}
+    explicit File(std::shared_ptr<sim_file> f) : f(f){}
+    operator bool() const;
+    size_t read(uint8_t *buf, size_t size);
+    int read();
+    size_t write(const uint8_t *buf, size_t size);
+    size_t write(uint8_t c);
+    int available();
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void close();
+    void flush(){}
+    const char *name() const;
+    const char *path() const;
+    bool isDirectory();
+    File openNextFile(const char *mode = FILE_READ);
+    void rewindDirectory();
+    time_t getLastWrite();
+  private:
+    std::shared_ptr<sim_file> f;
+};
+
+namespace fs { typedef ::File File; }
+
+#endif
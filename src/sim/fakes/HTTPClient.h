@@ -0,0 +1,34 @@
+#ifndef SIM_HTTPCLIENT_H
+#define SIM_HTTPCLIENT_H
+
+#include <WiFi.h>
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTPC_ERROR_CONNECTION_REFUSED -1
+
+/*
+  Simulated HTTP server backed by a directory on the host: the path of a URL (any host) names a file under it. A GET
+  takes the server's connect time, then the body arrives at its transfer rate, in simulated time, and the connection
+  closes once all of it has been read. Until simHttpServe() is called every request fails to connect.
+*/
+class HTTPClient{
+  public:
+    ~HTTPClient(){ end(); }
+    bool begin(const char *url);
+    void end();
+    int GET();
+    int getSize(){ return client.file != NULL ? client.size : -1; }
+    WiFiClient *getStreamPtr(){ return &client; }
+    void useHTTP10(bool use){}
+    void setTimeout(uint16_t timeout){}
+    void setConnectTimeout(int32_t timeout){}
+  private:
+    char path[256] = "";
+    WiFiClient client;
+};
+
+// Provided in simulator
+void simHttpServe(const char *host_dir, uint32_t bytes_per_second, uint32_t connect_ms);
+
+#endif
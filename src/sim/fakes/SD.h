@@ -0,0 +1,34 @@
+#ifndef SIM_SD_H
+#define SIM_SD_H
+
+#include <FS.h>
+#include <SPI.h>
+
+/*
+  Simulated SD card backed by a directory on the host. Files are read from the host; anything written (such as the tone
+  index) is kept in memory so a run never modifies the host directory. Every open and read is delayed according to a
+  latency profile (see simSdLoadProfile()), and transfers run no faster than the SPI clock passed to begin() allows.
+
+  The card shares the SPI bus with the codec, so any overlapping access from two tasks is counted as a bus conflict.
+*/
+
+class SDFS{
+  public:
+    bool begin(uint8_t cs = 5, SPIClass &spi = SPI, uint32_t frequency = 4000000);
+    File open(const char *path, const char *mode = FILE_READ);
+    bool exists(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *from, const char *to);
+    bool mkdir(const char *path);
+};
+extern SDFS SD;
+
+// Provided in simulator
+void simSdSetRoot(const char *host_dir);            // host directory that is the root of the card
+bool simSdLoadProfile(const char *profile_path);    // latency profile; see src/sim/profiles
+void simBusHold(int64_t us);                         // hold the bus as a transfer of that length would
+void simBusEnter();                                 // SPI bus access by the card or the codec
+void simBusExit();
+uint32_t simBusConflicts();
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef SIM_SPI_H
+#define SIM_SPI_H
+
+#include <Arduino.h>
+
+/*
+  Simulated SPI bus. A transaction holds the bus (see simBusEnter()), costs SIM_SPI_TRANSACTION_US to set up, and each
+  byte takes eight clock periods at the transaction's clock. Bytes written while the codec's data port is selected reach the simulated VS1053.
+*/
+
+#define SIM_SPI_TRANSACTION_US 5   // beginTransaction() and endTransaction(): driver lock, clock reconfiguration, chip select
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings{
+  public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bit_order = MSBFIRST, uint8_t data_mode = SPI_MODE0) : clock(clock){}
+    uint32_t clock;
+};
+
+class SPIClass{
+  public:
+    void begin(){}
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    void writeBytes(const uint8_t *data, uint32_t size);
+  private:
+    uint32_t clock = 1000000;
+};
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include <Arduino.h>
+
+// The body of a response from the simulated HTTP server (see HTTPClient.h)
+class WiFiClient{
+  public:
+    int available();
+    int read(uint8_t *buf, size_t size);
+    uint8_t connected();
+  private:
+    friend class HTTPClient;
+    FILE *file = NULL;
+    uint32_t size = 0;
+    uint32_t pos = 0;
+    int64_t started_us = 0;       // simulated time the first byte of the body arrived
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+/*
+  Stand-in for the I2C bus object; the simulated panel (Adafruit_SSD1327.h) does its own I2C accounting.
+*/
+
+class TwoWire{};
+extern TwoWire Wire;
+
+#endif
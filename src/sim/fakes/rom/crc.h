@@ -0,0 +1,8 @@
+#ifndef SIM_ROM_CRC_H
+#define SIM_ROM_CRC_H
+
+#include <stdint.h>
+
+uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len);    // same result as the ESP32 ROM routine
+
+#endif
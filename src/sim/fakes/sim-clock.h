@@ -0,0 +1,41 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+#include <functional>
+#include <mutex>
+
+/*
+  Virtual time and scheduling for the host-side simulator, modelled on the single core ESP32-S2.
+
+  Simulated threads (tasks, the timer dispatcher, the codec and main() as loopTask) each run on a host thread, but only
+  one of them runs at a time and running takes no simulated time. A thread runs until it waits; the highest priority
+  thread that can go then runs next, and once none can, time jumps straight to the earliest deadline. Runs are therefore
+  as fast as the host allows and give the same results on any host, which keeps CI results repeatable.
+
+  Every wait in a simulated thread must go through simWait() (or something built on it). A loop that polls millis()
+  without waiting never lets time pass.
+*/
+
+#define SIM_PRIORITY_LOOP 1           // loopTask, which main() stands in for
+
+// *********************************************************************************************************************
+// *** Data Types ***
+struct sim_thread;
+
+struct sim_mutex{                     // recursive; blocking in simulated time
+  sim_thread *owner = nullptr;
+  int depth = 0;
+};
+
+// Provided in simulator
+int64_t simMicros();                                                          // simulated time since start
+void simSleepMicros(int64_t us);
+std::unique_lock<std::mutex> simLock();                                       // guards the scheduler; held only while deciding to wait
+bool simWait(std::unique_lock<std::mutex> &lock, const std::function<bool()> &ready, int64_t deadline_us = -1);  // false if the deadline passed first
+void simSpawn(std::function<void()> body, int priority);                      // start a simulated thread; it first runs when scheduled
+bool simMutexLock(sim_mutex &m, int64_t deadline_us = -1);                    // false if the deadline passed first
+void simMutexUnlock(sim_mutex &m);
+bool simMutexHeldByOther(sim_mutex &m);
+
+#endif
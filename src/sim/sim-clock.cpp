@@ -0,0 +1,152 @@
+#include "sim-clock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+struct sim_thread{
+  int priority;
+  bool waiting = false;
+  const std::function<bool()> *ready = nullptr;
+  int64_t deadline_us = -1;           // -1 for none
+};
+
+static std::mutex scheduler_mutex;
+static std::condition_variable scheduled;
+static std::atomic<int64_t> now_us(0);
+static std::vector<sim_thread *> threads;   // creation order; ties in priority go to the earliest
+static sim_thread *current = nullptr;
+static thread_local sim_thread *self = nullptr;
+static const std::function<bool()> always = [](){ return true; };
+
+// main() is a simulated thread from the start
+static sim_thread *selfThread(){
+  if(self == nullptr){
+    self = new sim_thread{SIM_PRIORITY_LOOP};
+    threads.push_back(self);
+    current = self;
+  }
+  return self;
+}
+
+static bool canRun(const sim_thread *t){
+  return t->waiting && ((*t->ready)() || (t->deadline_us >= 0 && t->deadline_us <= now_us));
+}
+
+// Called with the lock held by the thread giving up the CPU: pick the next one, moving time on if nothing can run now
+static void schedule(){
+  for(;;){
+    sim_thread *best = nullptr;
+    int64_t next = -1;
+    for(sim_thread *t : threads){
+      if(canRun(t)){
+        if(best == nullptr || t->priority > best->priority){
+          best = t;
+        }
+      }
+      else if(t->waiting && t->deadline_us >= 0 && (next < 0 || t->deadline_us < next)){
+        next = t->deadline_us;
+      }
+    }
+    if(best != nullptr){
+      current = best;
+      scheduled.notify_all();
+      return;
+    }
+    if(next < 0){
+      fprintf(stderr, "Simulation deadlocked: every thread is waiting with no deadline\n");
+      abort();
+    }
+    now_us = next;
+  }
+}
+
+int64_t simMicros(){
+  return now_us;
+}
+
+void simSleepMicros(int64_t us){
+  static const std::function<bool()> never = [](){ return false; };
+  auto lock = simLock();
+  simWait(lock, never, now_us + std::max(us, (int64_t)0));
+}
+
+std::unique_lock<std::mutex> simLock(){
+  return std::unique_lock<std::mutex>(scheduler_mutex);
+}
+
+bool simWait(std::unique_lock<std::mutex> &lock, const std::function<bool()> &ready, int64_t deadline_us){
+  sim_thread *me = selfThread();
+  while(!ready()){
+    if(deadline_us >= 0 && now_us >= deadline_us){
+      return false;
+    }
+    me->waiting = true;
+    me->ready = &ready;
+    me->deadline_us = deadline_us;
+    schedule();
+    scheduled.wait(lock, [me](){ return current == me; });
+    me->waiting = false;
+  }
+  return true;
+}
+
+void simSpawn(std::function<void()> body, int priority){
+  auto lock = simLock();
+  selfThread();
+  sim_thread *t = new sim_thread{priority};
+  t->waiting = true;
+  t->ready = &always;
+  threads.push_back(t);
+  std::thread([t, body](){
+    {
+      auto lock = simLock();
+      self = t;
+      scheduled.wait(lock, [t](){ return current == t; });
+      t->waiting = false;
+    }
+    body();
+    auto lock = simLock();
+    threads.erase(std::find(threads.begin(), threads.end(), t));
+    schedule();
+  }).detach();
+}
+
+bool simMutexLock(sim_mutex &m, int64_t deadline_us){
+  auto lock = simLock();
+  sim_thread *me = selfThread();
+  if(!simWait(lock, [&m, me](){ return m.depth == 0 || m.owner == me; }, deadline_us)){
+    return false;
+  }
+  m.owner = me;
+  m.depth++;
+  return true;
+}
+
+void simMutexUnlock(sim_mutex &m){
+  auto lock = simLock();
+  if(--m.depth == 0){
+    m.owner = nullptr;
+    // as in FreeRTOS, a higher priority task waiting for the mutex runs as soon as it is given, not when the giver next waits
+    sim_thread *me = selfThread();
+    for(sim_thread *t : threads){
+      if(t->priority > me->priority && canRun(t)){
+        me->waiting = true;
+        me->ready = &always;
+        me->deadline_us = -1;
+        schedule();
+        scheduled.wait(lock, [me](){ return current == me; });
+        me->waiting = false;
+        break;
+      }
+    }
+  }
+}
+
+bool simMutexHeldByOther(sim_mutex &m){
+  auto lock = simLock();
+  return m.depth > 0 && m.owner != selfThread();
+}
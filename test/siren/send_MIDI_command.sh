@@ -0,0 +1,11 @@
+#!/bin/bash
+
+# -----------------------------------------------------------------------------
+source env.sh
+
+# Plays the first phrase of the Westminster chimes on tubular bells (General MIDI program 14) with the codec's synthesiser.
+# Each note is [program, note, velocity, duration_ms]; no file on the SD card is needed.
+
+mosquitto_pub -h $MOSQUITTO_HOST -p $MOSQUITTO_PORT -t "$BASE_TOPIC/command" \
+-u $USR -P $PWD \
+-m "{\"state\":\"ON\", \"volume_set\": 0.7, \"midi\": [ [14,76,100,500], [14,72,100,500], [14,74,100,500], [14,67,100,1000] ] }"
@@ -0,0 +1,12 @@
+#!/bin/bash
+
+# -----------------------------------------------------------------------------
+source env.sh
+
+# Plays the doorbell tone twice, pauses half a second, then the alarm tone.
+# Transitions without a gap_ms are gapless. The state topic only reports OFF once the whole sequence has finished.
+# Sequences are not available through the Home Assistant siren service; publish them directly (e.g. mqtt.publish).
+
+mosquitto_pub -h $MOSQUITTO_HOST -p $MOSQUITTO_PORT -t "$BASE_TOPIC/command" \
+-u $USR -P $PWD \
+-m "{\"state\":\"ON\", \"volume_set\": 0.7, \"sequence\": [ {\"tone\": \"doorbell.wav\", \"repeat\": 2, \"gap_ms\": 500}, {\"tone\": \"alarm.wav\"} ] }"
@@ -0,0 +1,14 @@
+#!/bin/bash
+
+# -----------------------------------------------------------------------------
+source env.sh
+
+# Streams a file over HTTP instead of playing a tone from the SD card.
+# Serve the tones from a Linux box first, e.g.  ./stream-server.py ../../content/tones --rate 16000
+# and replace the address below with that box's address on the LAN.
+
+STREAM_URL=${1:-"http://192.168.1.10:8000/doorbell.wav"}
+
+mosquitto_pub -h $MOSQUITTO_HOST -p $MOSQUITTO_PORT -t "$BASE_TOPIC/command" \
+-u $USR -P $PWD \
+-m "{\"state\":\"ON\", \"volume_set\": 0.7, \"url\": \"$STREAM_URL\" }"
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+# Stand-in for a Home Assistant media URL or TTS server, for testing streaming (url commands) from a Linux box.
+# Serves the files in a directory over HTTP/1.0, optionally throttled and with stalls, to exercise the jitter buffer.
+#
+#   ./stream-server.py ../../content/tones --rate 16000 --stall-every 5 --stall-ms 1500
+#
+# --rate is in bytes per second (16000 is 128kbit/s). A stall longer than AUDIO_STREAM_JITTER_MS should show up
+# as an underrun in the stream_underruns diagnostic; shorter ones should be absorbed without a glitch.
+
+import argparse
+import functools
+import http.server
+import time
+
+class ThrottledHandler(http.server.SimpleHTTPRequestHandler):
+    rate = 0
+    stall_every = 0
+    stall_ms = 0
+
+    def copyfile(self, source, outputfile):
+        chunk = 1024 if self.rate else 64 * 1024
+        started = time.monotonic()
+        sent = 0
+        next_stall = self.stall_every
+        while True:
+            buf = source.read(chunk)
+            if not buf:
+                break
+            outputfile.write(buf)
+            sent += len(buf)
+            if self.rate:
+                ahead = sent / self.rate - (time.monotonic() - started)
+                if ahead > 0:
+                    time.sleep(ahead)
+            if self.stall_every and self.rate and sent / self.rate >= next_stall:
+                self.log_message("stall %d ms after %d bytes", self.stall_ms, sent)
+                time.sleep(self.stall_ms / 1000)
+                started += self.stall_ms / 1000
+                next_stall += self.stall_every
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("directory")
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--rate", type=int, default=0, help="bytes per second; 0 is unthrottled")
+    parser.add_argument("--stall-every", type=float, default=0, help="seconds of audio between stalls")
+    parser.add_argument("--stall-ms", type=int, default=0, help="length of each stall")
+    args = parser.parse_args()
+
+    ThrottledHandler.rate = args.rate
+    ThrottledHandler.stall_every = args.stall_every
+    ThrottledHandler.stall_ms = args.stall_ms
+    handler = functools.partial(ThrottledHandler, directory=args.directory)
+    with http.server.ThreadingHTTPServer(("", args.port), handler) as server:
+        print(f"Serving {args.directory} on port {args.port}")
+        server.serve_forever()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+
+# Uploads a tone to the SD card over MQTT (see lib/tone-upload/tone-upload.h), so it can be played without pulling the card.
+# Once it is complete the tone is in the siren's available_tones in Home Assistant.
+#
+#   pip install paho-mqtt
+#   source env.sh && ./upload-tone.py ../../content/tones/doorbell.wav --name bell.wav
+#
+# With --graphic it uploads a graphic for display commands instead, a LABEL.gfx made by lib/display/make-bitmaps.py --blob
+# (see lib/graphic-store/graphic-store.h); display commands can then use LABEL as their graphic.
+#
+# Chunks are sent with QoS 0 and numbered; the board reports on the status topic which chunk it expects next and how much
+# is on the card, and the sender keeps no more than --window chunks beyond that. A dropped chunk is resent from where the
+# board says. If the board goes quiet (broker or wifi drop, reboot) the upload is begun again and resumes where the card
+# left off. --rate caps the send rate in KB/s, e.g. to leave room for other traffic; 0 sends as fast as the window allows.
+
+import argparse
+import json
+import os
+import struct
+import sys
+import threading
+import time
+import zlib
+
+import paho.mqtt.client as mqtt
+
+CHUNK = 4096            # TONE_UPLOAD_CHUNK
+WINDOW = 8              # TONE_UPLOAD_SLOTS
+FRAME = struct.Struct("<III")   # tone_upload_frame: upload id (CRC32 of the tone), sequence number, CRC32 of the chunk
+QUIET_S = 2.0           # begin again after this long without a status
+
+
+class Upload:
+    def __init__(self, data, name):
+        self.data = data
+        self.name = name
+        self.crc = zlib.crc32(data)
+        self.chunks = (len(data) + CHUNK - 1) // CHUNK
+        self.status = None
+        self.heard = threading.Condition()
+
+    def on_status(self, payload):
+        status = json.loads(payload)
+        if status.get("name") != self.name:
+            return
+        with self.heard:
+            self.status = status
+            self.heard.notify()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload a tone to Chime over MQTT")
+    parser.add_argument("tone")
+    parser.add_argument("--name", help="name on the SD card (default: the file's name)")
+    parser.add_argument("--graphic", action="store_true", help="a graphic blob (LABEL.gfx) rather than a tone")
+    parser.add_argument("--host", default=os.environ.get("MOSQUITTO_HOST", "127.0.0.1"))
+    parser.add_argument("--port", type=int, default=int(os.environ.get("MOSQUITTO_PORT", "1883")))
+    parser.add_argument("--user", default=os.environ.get("USR"))
+    parser.add_argument("--password", default=os.environ.get("PWD"))
+    parser.add_argument("--base-topic", default=os.environ.get("BASE_TOPIC", "homeassistant/siren/featheresp32s2"))
+    parser.add_argument("--window", type=int, default=WINDOW)
+    parser.add_argument("--rate", type=float, default=0, help="KB/s; 0 for no limit")
+    args = parser.parse_args()
+
+    with open(args.tone, "rb") as f:
+        upload = Upload(f.read(), args.name or os.path.basename(args.tone))
+    begin = '{"name": "%s", "size": %d, "crc": %d, "chunk": %d, "kind": "%s"}' % (
+        upload.name, len(upload.data), upload.crc, CHUNK, "graphic" if args.graphic else "tone")
+
+    try:
+        client = mqtt.Client(mqtt.CallbackAPIVersion.VERSION2)
+    except AttributeError:
+        client = mqtt.Client()  # paho-mqtt 1.x
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_message = lambda c, u, msg: upload.on_status(msg.payload)
+    client.on_connect = lambda c, *a: c.subscribe(args.base_topic + "/upload/status")
+    client.connect(args.host, args.port)
+    client.loop_start()
+    time.sleep(0.5)
+
+    started = time.monotonic()
+    next_seq = 0
+    base = 0
+    dropped = 0
+    last_heard = 0
+    rewind = True   # the answer to a begin says where to start
+    client.publish(args.base_topic + "/upload/begin", begin, qos=1)
+    while True:
+        with upload.heard:
+            status = upload.status
+            upload.status = None
+        now = time.monotonic()
+        if status is not None:
+            last_heard = now
+            state = status["state"]
+            base = status["written"] // CHUNK
+            if state == "failed":
+                sys.exit("upload failed: %s" % status["error"])
+            if state == "complete":
+                break
+            if state == "receiving" and (rewind or status["dropped"] != dropped or next_seq < status["next_seq"]):
+                next_seq = status["next_seq"]   # go back to the first chunk the board has not accepted
+                rewind = False
+            dropped = status["dropped"]
+            print("\r%s %d of %d bytes on the card" % (state, status["written"], len(upload.data)), end="", flush=True)
+        elif now - max(last_heard, started) > QUIET_S:
+            last_heard = now
+            rewind = True
+            client.publish(args.base_topic + "/upload/begin", begin, qos=1)   # resumes where the board is
+            continue
+
+        sent = False
+        while next_seq < upload.chunks and next_seq < base + args.window and last_heard > 0:
+            if args.rate and next_seq * CHUNK > (now - started) * args.rate * 1024:
+                break
+            chunk = upload.data[next_seq * CHUNK:(next_seq + 1) * CHUNK]
+            client.publish(args.base_topic + "/upload/chunk", FRAME.pack(upload.crc, next_seq, zlib.crc32(chunk)) + chunk, qos=0)
+            next_seq += 1
+            sent = True
+        if not sent:
+            with upload.heard:
+                upload.heard.wait(0.05)
+
+    elapsed = time.monotonic() - started
+    print("\n%s: %d bytes in %.1fs (%.1f KB/s)" % (upload.name, len(upload.data), elapsed, len(upload.data) / 1024 / elapsed))
+    client.loop_stop()
+
+
+if __name__ == "__main__":
+    main()